@@ -28,10 +28,14 @@
 /*******************************************************************************
  * Types/enumerations/variables
  ******************************************************************************/
-// send only one byte per transfer, see WriteRegister functions
-#define BUFFER_SIZE  1 
+// Longest register burst: the whole FIFO in a single transfer
+#define MFRC522_BURST_SIZE 64
+// address byte + one burst, see Write/ReadNRegister functions
+#define BUFFER_SIZE  (MFRC522_BURST_SIZE + 1)
 // Defined as 4MHz in the original library
 #define MFRC522_BIT_RATE 4000000 
+// Longest wait for a command completion signaled by the IRQ pin
+#define MFRC522_IRQ_TIMEOUT_MS 40
 // Used for ADT object allocation
 #define MFRC_MAX_INSTANCES 2	 
 
@@ -271,6 +275,12 @@ typedef struct {
 				 // after successful selection.
 } Uid;
 
+// A register and the value to write to it, see PCD_WriteRegisterList()
+typedef struct {
+	uint8_t reg;   // One of the PCD_Register enums.
+	uint8_t value; // The value to write.
+} PCD_RegValue;
+
 // A struct used for passing a MIFARE Crypto1 key
 typedef struct { uint8_t keybyte[MF_KEY_SIZE]; } MIFARE_Key;
 
@@ -313,7 +323,11 @@ MFRC522Ptr_t MFRC522_Init();
 void PCD_WriteRegister(MFRC522Ptr_t mfrc, uint8_t reg, uint8_t value);
 void PCD_WriteNRegister(MFRC522Ptr_t mfrc, uint8_t reg, uint8_t count,
 						uint8_t *values);
+void PCD_WriteRegisterList(MFRC522Ptr_t mfrc, const PCD_RegValue *list,
+						   uint8_t count);
 uint8_t PCD_ReadRegister(MFRC522Ptr_t mfrc, uint8_t reg);
+void PCD_ReadRegisterList(MFRC522Ptr_t mfrc, const uint8_t *regs,
+						  uint8_t count, uint8_t *values);
 void PCD_ReadNRegister(MFRC522Ptr_t mfrc, uint8_t reg, uint8_t count,
 					   uint8_t *values, uint8_t rxAlign);
 void setBitMask(unsigned char reg, unsigned char mask);
@@ -331,6 +345,9 @@ void PCD_AntennaOn(MFRC522Ptr_t mfrc);
 void PCD_AntennaOff(MFRC522Ptr_t mfrc);
 uint8_t PCD_GetAntennaGain(MFRC522Ptr_t mfrc);
 void PCD_SetAntennaGain(MFRC522Ptr_t mfrc, uint8_t mask);
+void PCD_EnableIrq(MFRC522Ptr_t mfrc, gpio_t irqPin);
+void PCD_SetTimeout(MFRC522Ptr_t mfrc, uint16_t ms);
+void PCD_WaitTimer(MFRC522Ptr_t mfrc, uint16_t ms);
 
 /*******************************************************************************
 * Functions for communicating with PICCs
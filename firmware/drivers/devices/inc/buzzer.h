@@ -17,6 +17,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 08/04/2024 | Document creation		                         |
+ * | 19/10/2026 | Non-blocking melody sequencer                  |
  *
  */
 
@@ -24,6 +25,7 @@
 #include <stdint.h>
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
+#define BUZZER_QUEUE_LEN    4       /*!< Max. number of melodies waiting to be played */
 /* Note frequency (in Hz) */
 #define NOTE_B0  31
 #define NOTE_C1  33
@@ -115,6 +117,34 @@
 #define NOTE_D8  4699
 #define NOTE_DS8 4978
 /*==================[typedef]================================================*/
+/**
+ * @brief Single note of a compiled melody.
+ */
+typedef struct {
+	uint16_t freq;			/*!< Tone frequency (in Hz), 0 for a silence */
+	uint16_t duration;		/*!< Note duration (in ms) */
+} buzzer_note_t;
+
+/**
+ * @brief Melody priority. A melody preempts the one being played if its priority is equal or higher.
+ */
+typedef enum {
+	BUZZER_PRIO_LOW = 0,	/*!< UI feedback (clicks, beeps) */
+	BUZZER_PRIO_NORMAL,		/*!< Songs, notifications */
+	BUZZER_PRIO_ALARM		/*!< Alarms */
+} buzzer_prio_t;
+
+/**
+ * @brief Melody to be played by the sequencer (see BuzzerPlayAsync()).
+ */
+typedef struct {
+	const buzzer_note_t *notes;	/*!< Note table (see BuzzerCompileRtttl()), must remain valid while playing */
+	uint16_t n_notes;			/*!< Number of notes in the table */
+	buzzer_prio_t prio;			/*!< Melody priority */
+	bool loop;					/*!< Restart the melody when finished (until stopped or preempted) */
+	void *func_p;				/*!< Pointer to callback function to call when the melody ends (NULL if not used) */
+	void *param_p;				/*!< Pointer to callback function parameter */
+} buzzer_melody_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -161,6 +191,54 @@ void BuzzerPlayTone(uint16_t freq, uint16_t duration);
  */
 void BuzzerPlayRtttl(const char * rtttl_melody);
 
+/**
+ * @brief Translates a RTTTL melody into a note table, so it can be played with BuzzerPlayAsync().
+ * 
+ * @param rtttl_melody String containing text with a RTTTL melody.
+ * @param note_table Note table to fill.
+ * @param max_notes Size of the note table.
+ * @return Number of notes written to the table.
+ */
+uint16_t BuzzerCompileRtttl(const char * rtttl_melody, buzzer_note_t * note_table, uint16_t max_notes);
+
+/**
+ * @brief Sequencer initialization. Creates the task in charge of playing melodies in background.
+ * 
+ * @note Call it after BuzzerInit(). While the sequencer is playing, don't use the blocking functions.
+ */
+void BuzzerSequencerInit(void);
+
+/**
+ * @brief Plays a melody in background, the function returns immediately.
+ * 
+ * If the melody has equal or higher priority than the one being played, it replaces it
+ * (the callback of the replaced melody is called). Otherwise, it waits in queue.
+ * 
+ * @note The callback function is executed in the sequencer task context.
+ * 
+ * @note If BUZZER_QUEUE_LEN melodies are already waiting, a lower priority melody is discarded
+ * by the sequencer task (its callback is called without playing it), even though this function
+ * returned true.
+ * 
+ * @param melody Melody to play (the struct is copied, the note table is not).
+ * @return true if the melody was sent to the sequencer, false if the command queue is full or
+ * BuzzerSequencerInit() wasn't called.
+ */
+bool BuzzerPlayAsync(const buzzer_melody_t * melody);
+
+/**
+ * @brief Stops the melody being played and discards the ones in queue (does nothing if
+ * BuzzerSequencerInit() wasn't called).
+ */
+void BuzzerStop(void);
+
+/**
+ * @brief Checks if the sequencer is playing a melody.
+ * 
+ * @return true if playing, false if idle.
+ */
+bool BuzzerIsPlaying(void);
+
 /**
  * @brief Buzzer de-initialization.
  */
@@ -15,6 +15,11 @@
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
  * 
+ * @note font_59 and font_89 are stored run-length encoded (FONT_RLE), converted in place from 
+ * the bitmap fonts with tools/font_to_rle.py. Each byte of a glyph codes a run of pixels: bit 7 is the pixel value 
+ * and bits 0-6 the run length minus one. Glyphs are coded row by row, without padding, and
+ * char_info_t::offset points to the first byte of the glyph.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -22,14 +27,26 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 19/10/2026 | Run-length encoded font format		                         			|
+ * | 19/10/2026 | font_59 and font_89 run-length encoded		                         		|
+ * | 19/10/2026 | RLE masks shared by the glyph decoders		                         		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define FONT_RLE_PIXEL_MSK	0x80	/*!< Pixel value of a run (FONT_RLE) */
+#define FONT_RLE_LEN_MSK	0x7F	/*!< Run length minus one (FONT_RLE) */
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Font data format
+ */
+typedef enum{
+	FONT_BITMAP = 0,	/*!< 1 bit per pixel, each glyph row padded to a byte */
+	FONT_RLE			/*!< Run-length encoded */
+} font_format_t;
 /**
  * @brief Character information
  */
@@ -44,6 +61,7 @@ typedef struct{
 	uint8_t 		font_height;   	/*!< Font height in pixels */
 	char_info_t 	*info;			/*!< Character info array */
 	const uint8_t 	*data; 			/*!< Font array */
+	font_format_t	format;			/*!< Font array format (FONT_BITMAP if not initialized) */
 } Font_t;
 
 /*==================[external data declaration]==============================*/
@@ -17,12 +17,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         						|
+ * | 19/10/2026 | Interrupt-driven streaming acquisition		                         	|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
+#define HX711_RING_LEN	16		/*!< Samples stored by the streaming acquisition */
 
 /*==================[typedef]================================================*/
 
@@ -120,6 +122,39 @@ void HX711_powerDown(void);
  */
 void HX711_powerUp(void);
 
+/** @fn HX711_streamStart(uint8_t avg_len)
+ * @brief Starts the interrupt-driven acquisition. Every falling edge of DOUT (data ready) 
+ * triggers a read of the sample, which is stored in a ring buffer. No task waits for the chip.
+ * @note Don't use the blocking functions (read, readAverage, tare...) while streaming
+ * @param[in] avg_len Number of samples of the moving average (1 to HX711_RING_LEN)
+ */
+void HX711_streamStart(uint8_t avg_len);
+
+/** @fn HX711_streamStop(void)
+ * @brief Stops the interrupt-driven acquisition
+ */
+void HX711_streamStop(void);
+
+/** @fn HX711_streamRead(uint32_t *samples, uint8_t max)
+ * @brief Copies the samples acquired since the last call (oldest first), in the same format as HX711_read()
+ * @param[out] samples Buffer for the samples
+ * @param[in] max Size of the buffer
+ * @return Number of samples copied
+ */
+uint8_t HX711_streamRead(uint32_t *samples, uint8_t max);
+
+/** @fn HX711_streamAverage(void)
+ * @brief Returns the moving average of the last samples acquired
+ * @return Averaged value
+ */
+uint32_t HX711_streamAverage(void);
+
+/** @fn HX711_streamUnits(void)
+ * @brief Returns the moving average without the tare weight, divided by SCALE (same calibration as HX711_getUnits())
+ * @return Weight value
+ */
+float HX711_streamUnits(void);
+
 /*==================[internal functions declaration]=========================*/
 // Sends/receives data. 
 uint8_t shiftIn(void);
@@ -33,6 +33,12 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 19/10/2026 | Glyph cache and single burst string drawing    |
+ * | 19/10/2026 | Compressed pictures                            |
+ * | 19/10/2026 | Hardware scrolling                             |
+ * | 19/10/2026 | Span rasterizer for filled shapes              |
+ * | 19/10/2026 | Palette indexed pixel blocks                   |
+ * | 19/10/2026 | Glyph decoder shared with lcd_canvas           |
  *
  */
 
@@ -46,6 +52,13 @@
 #define ILI9341_WIDTH       240			/*!< LCD width in pixels */
 #define ILI9341_HEIGHT      320			/*!< LCD height in pixels */
 #define ILI9341_PIXEL_MAX	76800
+/* Glyph cache settings (can be overridden at compile time) */
+#ifndef ILI9341_GLYPH_CACHE_SIZE
+#define ILI9341_GLYPH_CACHE_SIZE	8192	/*!< Bytes of RAM for glyphs already expanded to RGB565 */
+#endif
+#ifndef ILI9341_GLYPH_CACHE_ENTRIES
+#define ILI9341_GLYPH_CACHE_ENTRIES	32		/*!< Maximum number of glyphs in cache */
+#endif
 /* 16bits colors (RGB565) */			/*	 R,   G,   B */
 #define ILI9341_BLACK          	0x0000  /*   0,   0,   0 */
 #define ILI9341_NAVY           	0x000F 	/*   0,   0, 128 */
@@ -80,7 +93,26 @@ typedef enum ili9341_orientation {
 	ILI9341_Landscape_1, 	/*!< Landscape orientation mode 1 */
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
+
+/**
+ * @brief  Compressed picture (palette indexed and run-length encoded)
+ * 
+ * @note Generated with tools/img_to_edu.py. The data array is a sequence of packets, each one
+ * starting with a header byte: if bit 7 is set, the next byte is a palette index repeated 
+ * (header & 0x7F) + 1 times; otherwise (header + 1) palette indexes follow.
+ */
+typedef struct {
+	uint16_t width;				/*!< Picture width in pixels */
+	uint16_t height;			/*!< Picture height in pixels */
+	const uint16_t *palette;	/*!< Colors (RGB565), up to 256 */
+	const uint8_t *data;		/*!< Compressed pixels */
+} ili9341_picture_t;
 /*==================[external data declaration]==============================*/
+/**
+ * @brief  ESP-EDU board picture (240x320, portrait), defined in esp_edu_pic.c
+ */
+extern const ili9341_picture_t esp_edu_pic;
+
 
 /*==================[external functions declaration]=========================*/
 /**
@@ -115,6 +147,12 @@ void ILI9341Fill(uint16_t color);
  */
 void ILI9341Rotate(ili9341_orientation_t orientation);
 
+/**
+ * @brief  		Returns the current LCD orientation
+ * @retval 		Orientation set with ILI9341Rotate
+ */
+ili9341_orientation_t ILI9341GetOrientation(void);
+
 /**
  * @brief  		Draw a single character on the LCD
  * @param[in]  	x: X position of top left corner
@@ -154,6 +192,8 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
 
 /**
  * @brief  		Draw a string on the LCD
+ * @note		Single line strings that fit on the screen are sent in a single burst, 
+ * 				including the 1 pixel gap between characters (drawn with background color).
  * @param[in] 	x: X position of top left corner of first character in string
  * @param[in]  	y: Y position of top left corner of first character in string
  * @param[in]  	str: Pointer to first character
@@ -164,6 +204,24 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
  */
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background);
 
+/**
+ * @brief  		Discards all the glyphs stored in the glyph cache
+ * @note		Characters are expanded to RGB565 and cached for each (font, foreground, background) 
+ * 				combination. Recently used glyphs are kept (LRU), so it's not necessary to call this function.
+ * @retval 		None
+ */
+void ILI9341GlyphCacheClear(void);
+/**
+ * @brief  		Decodes a character of any font format, as runs of equal pixels
+ * @note		Pixels are decoded row by row, left to right: runs can continue on the next row.
+ * @param[in]  	data: Character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	func_p: Function called for each run, with the pixel value (1: foreground, 0: background)
+ * 				and the run length
+ * @param[in]  	param_p: Parameter passed to func_p
+ * @retval 		None
+ */
+void ILI9341GlyphDecode(char data, Font_t *font, void (*func_p)(void *param, uint8_t pixel, uint16_t run), void *param_p);
 /**
  * @brief  		Gets width and height of box with text
  * @param[in]  	str: Pointer to first character
@@ -253,6 +311,28 @@ void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
  */
 void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 
+/**
+ * @brief  		Draws filled rectangle with rounded corners on the LCD
+ * @param[in]  	x0: X coordinate of top left corner
+ * @param[in]  	y0: Y coordinate of top left corner
+ * @param[in]  	x1: X coordinate of bottom right corner
+ * @param[in]  	y1: Y coordinate of bottom right corner
+ * @param[in]  	r: Corner radius
+ * @param[in]  	color: Rectangle color (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawFilledRoundRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, uint16_t color);
+
+/**
+ * @brief  		Draws filled polygon on the LCD (even-odd rule)
+ * @param[in]  	x: X coordinates of vertices
+ * @param[in]  	y: Y coordinates of vertices
+ * @param[in]  	n: Number of vertices (3 to 16)
+ * @param[in]  	color: Polygon color (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawFilledPolygon(const int16_t *x, const int16_t *y, uint8_t n, uint16_t color);
+
 /**
  * @brief  		Draw a picture on the LCD
  * @note		Pictures must be converted to uint8_t array. 
@@ -267,6 +347,58 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Draw a compressed picture on the LCD
+ * @note		The picture is decoded while it is sent: each burst is decoded while the previous one
+ * 				is being transferred.
+ * @param[in] 	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in]  	pic: Pointer to compressed picture (see tools/img_to_edu.py)
+ * @retval 		None
+ */
+void ILI9341DrawCompressedPicture(uint16_t x, uint16_t y, const ili9341_picture_t* pic);
+
+/**
+ * @brief  		Draw a block of palette indexes on the LCD (1, 2, 4 or 8 bits per pixel)
+ * @note		Indexes are expanded to RGB565 while they are sent: each burst is expanded while 
+ * 				the previous one is being transferred. The first pixel of each byte is in its most 
+ * 				significant bits.
+ * @param[in] 	x: X position of top left corner of block
+ * @param[in]  	y: Y position of top left corner of block
+ * @param[in] 	width: Block width in pixels
+ * @param[in]  	height: Block height in pixels
+ * @param[in]  	bpp: Bits per pixel (1, 2, 4 or 8)
+ * @param[in]  	data: Pointer to first byte of block
+ * @param[in]  	stride: Bytes from a row of the block to the next one
+ * @param[in]  	palette: Colors (RGB565), 2^bpp entries
+ * @retval 		None
+ */
+void ILI9341DrawIndexed(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t bpp,
+		const uint8_t *data, uint16_t stride, const uint16_t *palette);
+/**
+ * @brief  		Defines an area of the screen scrolled by hardware (vertical scrolling)
+ * @note		The scroll axis is the long side of the display: y in portrait orientations, x in landscape.
+ * 				Only one scrolling area can be used, and the orientation must not change while it is in use.
+ * 				Everything else must be drawn outside the area.
+ * @param[in] 	start: First line of the area (y in portrait, x in landscape)
+ * @param[in]  	length: Number of lines of the area
+ * @retval 		None
+ */
+void ILI9341ScrollInit(uint16_t start, uint16_t length);
+/**
+ * @brief  		Draws a new line at the end of the scrolling area, scrolling the rest one line
+ * @note		The oldest line is overwritten. In landscape the line is a screen column.
+ * @param[in] 	from: First pixel of the line (x in portrait, y in landscape)
+ * @param[in]  	to: Last pixel of the line (x in portrait, y in landscape)
+ * @param[in]  	pixels: Line colors (RGB565, 2 bytes/pixel, high byte first)
+ * @retval 		None
+ */
+void ILI9341ScrollPushLine(uint16_t from, uint16_t to, const uint8_t *pixels);
+/**
+ * @brief  		Exits scrolling mode
+ * @retval 		None
+ */
+void ILI9341ScrollDeInit(void);
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
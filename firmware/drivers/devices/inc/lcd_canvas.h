@@ -0,0 +1,227 @@
+#ifndef LCD_CANVAS_H_
+#define LCD_CANVAS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup LCD_Canvas LCD canvas
+ ** @{ */
+
+/** \brief Off-screen canvases with indexed colors for the ILI9341 color LCD.
+ *
+ * A canvas stores palette indexes instead of RGB565 colors, so a whole screen fits in RAM:
+ *
+ * | bpp | Colors | 240x320 canvas |
+ * |:---:|:------:|:--------------:|
+ * |  1  |    2   |      9.6 KB    |
+ * |  2  |    4   |     19.2 KB    |
+ * |  4  |   16   |     38.4 KB    |
+ * |  8  |  256   |     76.8 KB    |
+ *
+ * Drawing functions take palette indexes and only write the canvas. CanvasFlush() sends the
+ * area changed since the last flush, expanding the indexes to RGB565 while it is transferred
+ * (see ILI9341DrawIndexed()).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+#include "icons.h"
+/*==================[macros]=================================================*/
+/**
+ * @brief Bytes needed for the pixels of a canvas
+ */
+#define CANVAS_SIZE(width, height, bpp)		((((uint32_t)(width) * (bpp) + 7) / 8) * (height))
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Canvas
+ */
+typedef struct{
+	uint16_t width;				/*!< canvas width in pixels */
+	uint16_t height;			/*!< canvas height in pixels */
+	uint8_t bpp;				/*!< bits per pixel (1, 2, 4 or 8) */
+	const uint16_t *palette;	/*!< colors (RGB565), 2^bpp entries */
+	uint8_t *data;				/*!< pixels, CANVAS_SIZE(width, height, bpp) bytes */
+	uint16_t stride;			/*!< bytes per row (internal) */
+	int16_t dirty_x0;			/*!< changed area since last flush (internal) */
+	int16_t dirty_y0;			/*!< changed area since last flush (internal) */
+	int16_t dirty_x1;			/*!< changed area since last flush (internal) */
+	int16_t dirty_y1;			/*!< changed area since last flush (internal) */
+} canvas_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a canvas and fills it with a color
+ * @param[in]  	canvas: Canvas with its configuration
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasInit(canvas_t *canvas, uint8_t color);
+
+/**
+ * @brief  		Returns the palette index of a color
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	rgb: Color (RGB565)
+ * @retval 		Index of the color, 0 if it is not in the palette
+ */
+uint8_t CanvasColor(canvas_t *canvas, uint16_t rgb);
+
+/**
+ * @brief  		Fills the whole canvas with a color
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasFill(canvas_t *canvas, uint8_t color);
+
+/**
+ * @brief  		Draws a pixel
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: X coordinate
+ * @param[in]  	y: Y coordinate
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasDrawPixel(canvas_t *canvas, int16_t x, int16_t y, uint8_t color);
+
+/**
+ * @brief  		Returns the palette index of a pixel
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: X coordinate
+ * @param[in]  	y: Y coordinate
+ * @retval 		Palette index (0 outside the canvas)
+ */
+uint8_t CanvasGetPixel(canvas_t *canvas, int16_t x, int16_t y);
+
+/**
+ * @brief  		Draws a line
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x0: X coordinate of starting point
+ * @param[in]  	y0: Y coordinate of starting point
+ * @param[in]  	x1: X coordinate of ending point
+ * @param[in]  	y1: Y coordinate of ending point
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasDrawLine(canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+
+/**
+ * @brief  		Draws a rectangle
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x0: X coordinate of top left corner
+ * @param[in]  	y0: Y coordinate of top left corner
+ * @param[in]  	x1: X coordinate of bottom right corner
+ * @param[in]  	y1: Y coordinate of bottom right corner
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasDrawRectangle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+
+/**
+ * @brief  		Draws a filled rectangle
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x0: X coordinate of top left corner
+ * @param[in]  	y0: Y coordinate of top left corner
+ * @param[in]  	x1: X coordinate of bottom right corner
+ * @param[in]  	y1: Y coordinate of bottom right corner
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasDrawFilledRectangle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+
+/**
+ * @brief  		Draws a circle
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x0: X coordinate of circle center
+ * @param[in]  	y0: Y coordinate of circle center
+ * @param[in]  	r: Circle radius
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasDrawCircle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t r, uint8_t color);
+
+/**
+ * @brief  		Draws a filled circle
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x0: X coordinate of circle center
+ * @param[in]  	y0: Y coordinate of circle center
+ * @param[in]  	r: Circle radius
+ * @param[in]  	color: Palette index
+ * @retval 		None
+ */
+void CanvasDrawFilledCircle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t r, uint8_t color);
+
+/**
+ * @brief  		Draws a character
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	data: Character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Palette index of the character
+ * @param[in]  	background: Palette index of the background, or -1 to leave it unchanged
+ * @retval 		Character width in pixels
+ */
+uint8_t CanvasDrawChar(canvas_t *canvas, int16_t x, int16_t y, char data, Font_t *font, uint8_t foreground, int16_t background);
+
+/**
+ * @brief  		Draws a single line string
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	str: String
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Palette index of the string
+ * @param[in]  	background: Palette index of the background, or -1 to leave it unchanged
+ * @retval 		None
+ */
+void CanvasDrawString(canvas_t *canvas, int16_t x, int16_t y, const char *str, Font_t *font, uint8_t foreground, int16_t background);
+
+/**
+ * @brief  		Draws an icon
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	icon: Icon
+ * @param[in]  	icon_font: Pointer to icon size
+ * @param[in]  	foreground: Palette index of the icon
+ * @param[in]  	background: Palette index of the background, or -1 to leave it unchanged
+ * @retval 		None
+ */
+void CanvasDrawIcon(canvas_t *canvas, int16_t x, int16_t y, icon_t icon, icon_font_t *icon_font, uint8_t foreground, int16_t background);
+
+/**
+ * @brief  		Marks the whole canvas to be sent on the next flush
+ * @param[in]  	canvas: Canvas
+ * @retval 		None
+ */
+void CanvasInvalidate(canvas_t *canvas);
+
+/**
+ * @brief  		Sends the area of the canvas changed since the last flush to the LCD
+ * @param[in]  	canvas: Canvas
+ * @param[in]  	x: X position of the canvas on the LCD
+ * @param[in]  	y: Y position of the canvas on the LCD
+ * @retval 		None
+ */
+void CanvasFlush(canvas_t *canvas, uint16_t x, uint16_t y);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* LCD_CANVAS_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,310 @@
+#ifndef LCD_WIDGETS_H_
+#define LCD_WIDGETS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup LCD_Widgets LCD widgets
+ ** @{ */
+
+/** \brief Retained widgets for the ILI9341 color LCD.
+ *
+ * Each widget keeps the state it last drew on the display. Setters only store the new
+ * state and mark the widget as changed; WidgetScreenRender() then redraws, for every changed
+ * widget, only what differs from the previous frame:
+ * - Label: the characters from the first one that changed, and the tail left by a shorter text.
+ * - Numeric readout: the digit slots that changed.
+ * - Icon: the icon, when it or its color changed.
+ * - Bar meter (VU): the steps added or removed on each bar.
+ * - Progress bar: the track segment between the previous and the new position (and the knob).
+ * - Strip chart: the lines added since the last frame, scrolled by the display hardware.
+ *
+ * A widget is drawn completely the first time it is rendered and after WidgetInvalidate().
+ * The area of a widget is supposed to be filled with its background color when that happens
+ * (labels and icons only cover their own pixels).
+ *
+ * @note Setters and WidgetScreenRender() must be called from the same task.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+#include "icons.h"
+/*==================[macros]=================================================*/
+#define WIDGET_LABEL_LEN		24	/*!< Maximum length of a label (characters) */
+#define WIDGET_NUMBER_DIGITS	9	/*!< Maximum number of slots of a numeric readout (sign included) */
+#define WIDGET_BAR_MAX			32	/*!< Maximum number of bars of a bar meter */
+#define WIDGET_BAR_COLORS		4	/*!< Number of colors of a bar meter */
+#define WIDGET_STRIP_TRACES		4	/*!< Maximum number of traces of a strip chart */
+#define WIDGET_STRIP_LINES		16	/*!< Lines a strip chart keeps between renders */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Widget types
+ */
+typedef enum{
+	WIDGET_LABEL = 0,	/*!< Text */
+	WIDGET_NUMBER,		/*!< Numeric readout */
+	WIDGET_ICON,		/*!< Icon */
+	WIDGET_BAR,			/*!< Bar meter (VU) */
+	WIDGET_PROGRESS,	/*!< Progress bar */
+	WIDGET_STRIP		/*!< Strip chart */
+} widget_type_t;
+
+/**
+ * @brief Fields common to all widgets (first member of every widget)
+ */
+typedef struct{
+	uint16_t x_pos;			/*!< x position of top left corner */
+	uint16_t y_pos;			/*!< y position of top left corner */
+	uint16_t back_color;	/*!< background color */
+	widget_type_t type;		/*!< widget type (internal) */
+	bool dirty;				/*!< state changed since last render (internal) */
+	bool drawn;				/*!< display shows the widget (internal) */
+} widget_t;
+
+/**
+ * @brief Text label
+ */
+typedef struct{
+	widget_t base;							/*!< common fields */
+	Font_t *font;							/*!< text font */
+	uint16_t color;							/*!< text color */
+	char text[WIDGET_LABEL_LEN + 1];		/*!< text to show (internal, see WidgetLabelSet()) */
+	char shown[WIDGET_LABEL_LEN + 1];		/*!< text on display (internal) */
+} widget_label_t;
+
+/**
+ * @brief Numeric readout, right aligned in fixed width digit slots
+ */
+typedef struct{
+	widget_t base;							/*!< common fields */
+	Font_t *font;							/*!< digits font */
+	uint16_t color;							/*!< digits color */
+	uint8_t digits;							/*!< number of slots, sign included (WIDGET_NUMBER_DIGITS max) */
+	bool zero_pad;							/*!< fill unused slots with zeros instead of blanks */
+	int32_t value;							/*!< value to show (internal, see WidgetNumberSet()) */
+	uint8_t slot_width;						/*!< width of a slot in pixels (internal) */
+	char shown[WIDGET_NUMBER_DIGITS];		/*!< characters on display (internal) */
+} widget_number_t;
+
+/**
+ * @brief Icon
+ */
+typedef struct{
+	widget_t base;							/*!< common fields */
+	icon_font_t *icon_font;					/*!< icon size */
+	icon_t icon;							/*!< icon to show */
+	uint16_t color;							/*!< icon color */
+	icon_t shown;							/*!< icon on display (internal) */
+	uint16_t shown_color;					/*!< icon color on display (internal) */
+} widget_icon_t;
+
+/**
+ * @brief Bar meter (VU meter): bars made of steps, colored by height
+ */
+typedef struct{
+	widget_t base;							/*!< common fields */
+	uint16_t width;							/*!< meter width */
+	uint16_t height;						/*!< meter height */
+	uint8_t n_bars;							/*!< number of bars (WIDGET_BAR_MAX max) */
+	uint8_t step_height;					/*!< height of a step in pixels */
+	uint8_t step_pitch;						/*!< distance between steps in pixels */
+	uint16_t colors[WIDGET_BAR_COLORS];		/*!< step colors, from bottom to top */
+	uint8_t thresholds[WIDGET_BAR_COLORS - 1];	/*!< height (% of meter) where each color ends */
+	uint8_t level[WIDGET_BAR_MAX];			/*!< steps to show on each bar (internal) */
+	uint8_t shown[WIDGET_BAR_MAX];			/*!< steps on display on each bar (internal) */
+} widget_bar_t;
+
+/**
+ * @brief Horizontal progress bar with an optional round knob
+ */
+typedef struct{
+	widget_t base;							/*!< common fields (x_pos, y_pos: track top left corner) */
+	uint16_t width;							/*!< track width */
+	uint16_t height;						/*!< track height */
+	uint16_t track_color;					/*!< track outline color */
+	uint16_t color;							/*!< progress color */
+	uint16_t knob_color;					/*!< knob color */
+	uint8_t knob_radius;					/*!< knob radius (0: no knob) */
+	uint16_t max;							/*!< value at the end of the track */
+	uint16_t pos;							/*!< progress to show, in pixels (internal) */
+	uint16_t shown;							/*!< progress on display, in pixels (internal) */
+} widget_progress_t;
+
+/**
+ * @brief Trace of a strip chart
+ */
+typedef struct{
+	uint16_t y_scale;	/*!< y scale in % (number of pixels drawn per 100 data value) */
+	uint16_t y_offset; 	/*!< y offset */
+	uint16_t color;		/*!< trace color */
+	int16_t y_prev;		/*!< last position drawn (internal) */
+	int16_t y_min;		/*!< lowest position since last line (internal) */
+	int16_t y_max;		/*!< highest position since last line (internal) */
+} widget_trace_t;
+
+/**
+ * @brief Strip chart scrolled by the display hardware.
+ *
+ * New data is drawn as a line at the end of the chart while the rest scrolls. In landscape
+ * orientations time runs along x (lines are columns), in portrait orientations along y.
+ * Only one strip chart can be used, and nothing else can be drawn in the lines of the display
+ * covered by it (columns in landscape, rows in portrait).
+ */
+typedef struct{
+	widget_t base;							/*!< common fields */
+	uint16_t width;							/*!< chart width */
+	uint16_t height; 						/*!< chart height */
+	uint16_t x_scale;						/*!< time scale in % (lines drawn per 100 data samples, 100 max) */
+	uint8_t n_traces;						/*!< number of traces (WIDGET_STRIP_TRACES max) */
+	widget_trace_t *traces;					/*!< traces array */
+	uint16_t acc;							/*!< time scale accumulator (internal) */
+	int16_t lines[WIDGET_STRIP_LINES][WIDGET_STRIP_TRACES][2];	/*!< lines not drawn yet (internal) */
+	uint8_t head;							/*!< oldest line not drawn (internal) */
+	uint8_t count;							/*!< lines not drawn (internal) */
+} widget_strip_t;
+
+/**
+ * @brief Set of widgets rendered together
+ */
+typedef struct{
+	widget_t **widgets;		/*!< widgets array (pointers to the base field of each widget) */
+	uint8_t n_widgets;		/*!< number of widgets */
+} widget_screen_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a label
+ * @param[in]  	label: Label with its configuration
+ * @param[in]  	text: Initial text
+ * @retval 		None
+ */
+void WidgetLabelInit(widget_label_t *label, const char *text);
+
+/**
+ * @brief  		Changes the text of a label
+ * @param[in]  	label: Label
+ * @param[in]  	text: New text (WIDGET_LABEL_LEN characters max, single line)
+ * @retval 		None
+ */
+void WidgetLabelSet(widget_label_t *label, const char *text);
+
+/**
+ * @brief  		Initializes a numeric readout
+ * @param[in]  	num: Readout with its configuration
+ * @param[in]  	value: Initial value
+ * @retval 		None
+ */
+void WidgetNumberInit(widget_number_t *num, int32_t value);
+
+/**
+ * @brief  		Changes the value of a numeric readout
+ * @param[in]  	num: Readout
+ * @param[in]  	value: New value (clipped to the number of slots)
+ * @retval 		None
+ */
+void WidgetNumberSet(widget_number_t *num, int32_t value);
+
+/**
+ * @brief  		Initializes an icon
+ * @param[in]  	icon: Icon with its configuration
+ * @retval 		None
+ */
+void WidgetIconInit(widget_icon_t *icon);
+
+/**
+ * @brief  		Changes an icon
+ * @param[in]  	icon: Icon widget
+ * @param[in]  	id: New icon
+ * @param[in]  	color: New icon color
+ * @retval 		None
+ */
+void WidgetIconSet(widget_icon_t *icon, icon_t id, uint16_t color);
+
+/**
+ * @brief  		Initializes a bar meter, with all bars empty
+ * @param[in]  	bar: Bar meter with its configuration
+ * @retval 		None
+ */
+void WidgetBarInit(widget_bar_t *bar);
+
+/**
+ * @brief  		Changes the height of the bars of a bar meter
+ * @param[in]  	bar: Bar meter
+ * @param[in]  	values: Height of each bar (from 0 to 255)
+ * @retval 		None
+ */
+void WidgetBarSet(widget_bar_t *bar, const uint8_t *values);
+
+/**
+ * @brief  		Initializes a progress bar, with no progress
+ * @param[in]  	prog: Progress bar with its configuration
+ * @retval 		None
+ */
+void WidgetProgressInit(widget_progress_t *prog);
+
+/**
+ * @brief  		Changes the progress of a progress bar
+ * @param[in]  	prog: Progress bar
+ * @param[in]  	value: Progress (from 0 to max)
+ * @retval 		None
+ */
+void WidgetProgressSet(widget_progress_t *prog, uint16_t value);
+
+/**
+ * @brief  		Initializes a strip chart and its traces
+ * @param[in]  	strip: Strip chart with its configuration
+ * @retval 		None
+ */
+void WidgetStripInit(widget_strip_t *strip);
+
+/**
+ * @brief  		Adds a sample of every trace to a strip chart
+ * @note		If more than WIDGET_STRIP_LINES lines are added between renders, the oldest
+ * 				ones are drawn right away.
+ * @param[in]  	strip: Strip chart
+ * @param[in]  	data: Data values, one per trace
+ * @retval 		None
+ */
+void WidgetStripPush(widget_strip_t *strip, const int16_t *data);
+
+/**
+ * @brief  		Forces a widget to be drawn completely on the next render
+ * @param[in]  	widget: Widget (base field)
+ * @retval 		None
+ */
+void WidgetInvalidate(widget_t *widget);
+
+/**
+ * @brief  		Forces all the widgets of a screen to be drawn completely on the next render
+ * @param[in]  	screen: Screen
+ * @retval 		None
+ */
+void WidgetScreenInvalidate(widget_screen_t *screen);
+
+/**
+ * @brief  		Draws the changes of all the widgets of a screen
+ * @param[in]  	screen: Screen
+ * @retval 		None
+ */
+void WidgetScreenRender(widget_screen_t *screen);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* LCD_WIDGETS_H_ */
+
+/*==================[end of file]============================================*/
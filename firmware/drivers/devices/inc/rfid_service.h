@@ -0,0 +1,93 @@
+#ifndef RFID_SERVICE_H_
+#define RFID_SERVICE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup RFID_Service RFID service
+ ** @{ */
+
+/** \brief Card presence service for the MFRC522 RFID reader.
+ *
+ * A task watches the field and keeps a list of the cards in it, reporting arrivals and
+ * departures through a callback:
+ * - Without cards the antenna is off and the task sleeps on the MFRC522 timer interrupt
+ *   (IRQ pin), waking up only to send a single WUPA.
+ * - When a card answers, the anticollision loop (select, halt, next REQA) enumerates every
+ *   card in the field.
+ * - A card leaves after RFID_DEPARTURE_SCANS scans without answering.
+ *
+ * Block operations (rfid_utils) must be done from the callback, which runs in the service
+ * task, after selecting the card with RfidServiceSelect().
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "MFRC522.h"
+/*==================[macros]=================================================*/
+#define RFID_MAX_CARDS			4	/*!< Cards tracked at the same time */
+#define RFID_DEPARTURE_SCANS	2	/*!< Scans without answer before a card is considered gone */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Card events
+ */
+typedef enum{
+	RFID_CARD_ARRIVED = 0,	/*!< Card entered the field */
+	RFID_CARD_LEFT			/*!< Card left the field */
+} rfid_event_t;
+
+/**
+ * @brief Service configuration
+ */
+typedef struct{
+	MFRC522Ptr_t mfrc;			/*!< Reader, already initialized (see setupRFID()) */
+	gpio_t irq;					/*!< GPIO connected to the MFRC522 IRQ pin */
+	uint16_t idle_period;		/*!< Field check period without cards (ms, 1638 max) */
+	uint16_t scan_period;		/*!< Field scan period with cards present (ms, 1638 max) */
+	void *func_p;				/*!< Event callback: void (*)(rfid_event_t event, Uid *uid, void *param) */
+	void *param_p;				/*!< Callback parameter */
+} rfid_service_config_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Starts the service task
+ * @param[in]  	config: Service configuration
+ * @retval 		None
+ */
+void RfidServiceInit(rfid_service_config_t *config);
+
+/**
+ * @brief  		Returns the cards currently in the field
+ * @param[out]  uids: Array to store the UIDs
+ * @param[in]  	max: Size of the array
+ * @retval 		Number of cards
+ */
+uint8_t RfidServiceGetCards(Uid *uids, uint8_t max);
+
+/**
+ * @brief  		Wakes up and selects a card of the field, so block operations can be done on it
+ * @note		Call it from the event callback. The card is halted again by releaseCard().
+ * @param[in]  	uid: UID of the card
+ * @retval 		true if the card was selected
+ */
+bool RfidServiceSelect(Uid *uid);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RFID_SERVICE_H_ */
+
+/*==================[end of file]============================================*/
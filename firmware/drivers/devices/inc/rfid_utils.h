@@ -8,6 +8,10 @@
  * Auxiliary library to use MFRC522 library in the main.c file.
  * Released into the public domain. 
  *   Check UNLICENSE file in project root folder. 
+ *
+ * Changelog:
+ *   19/10/2026  readCardBalance()/writeCardBalance() no longer halt the card: it stays
+ *               selected and authenticated until releaseCard() is called.
  */
 
 #ifndef INC_RFID_UTILS_H
@@ -24,11 +28,28 @@
  */
 void setupRFID(MFRC522Ptr_t* mfrc522);
 
+/**
+ * Halt the card and stop Crypto1. Block operations keep their sector
+ * authenticated, so consecutive reads/writes on the same sector need a single
+ * authentication: call this function when done with the card.
+ * @param mfrc522 MFRC522 ADT pointer
+ */
+void releaseCard(MFRC522Ptr_t mfrc522);
+
+/**
+ * Stop Crypto1 and forget the authenticated sector, without halting the card.
+ * Call it before selecting cards again: the next block operation authenticates.
+ * @param mfrc522 MFRC522 ADT pointer
+ */
+void releaseAuth(MFRC522Ptr_t mfrc522);
+
 /**
  * Example function to read the card  balance, the balance is stored in the 
  * block 4 (sector 1), the first 4 bytes
  * @param  mfrc522 mfrc522 MFRC522 ADT pointer
  * @return         the balance is stored in the PICC, -999 if reading errors
+ * @note The card is left selected and its sector authenticated, so a read followed by a
+ * write authenticates once: call releaseCard() when done with the card.
  */
 int readCardBalance(MFRC522Ptr_t mfrc522);
 
@@ -38,6 +59,7 @@ int readCardBalance(MFRC522Ptr_t mfrc522);
  * @param  mfrc522    mfrc522 MFRC522 ADT pointer
  * @param  newBalance Desired balance to write to card.
  * @return            0 if no errors
+ * @note Like readCardBalance(), leaves the card selected: call releaseCard() when done.
  */
 int writeCardBalance(MFRC522Ptr_t mfrc522, int newBalance);
 
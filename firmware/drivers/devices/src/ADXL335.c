@@ -11,6 +11,7 @@
 /*
  * modification history (new versions first)
  * -----------------------------------------------------------
+ * 20261019 v0.0.2 calibrated conversion to mV (analog_io_mcu table)
  * 20210609 v0.0.1 initials initial version
  */
 
@@ -44,7 +45,7 @@ uint8_t canal; /**< Canal de la placa*/
 /*==================[internal functions declaration]=========================*/
 
 /**@fn float UnitConvert(uint16_t value)
- * @brief  Función que convierte el valor leído en unidades de gravedad
+ * @brief  Función que convierte el valor leído (en mV) en unidades de gravedad
  * @return valor convertido
  */
 float UnitConvert(uint16_t value);
@@ -87,6 +88,7 @@ int ReadXValueInt(){
 
 float ReadXValue(){
 	AnalogInputReadSingle(my_ad_x.input, &valor);
+	AnalogInputToMillivolts(my_ad_x.input, &valor, &valor, 1);
 	return UnitConvert(valor);
 }
 
@@ -97,6 +99,7 @@ int ReadYValueInt(){
 
 float ReadYValue(){
 	AnalogInputReadSingle(my_ad_y.input, &valor);
+	AnalogInputToMillivolts(my_ad_y.input, &valor, &valor, 1);
 	return UnitConvert(valor);
 }
 
@@ -107,6 +110,7 @@ int ReadZValueInt(){
 
 float ReadZValue(){
 	AnalogInputReadSingle(my_ad_z.input, &valor);
+	AnalogInputToMillivolts(my_ad_z.input, &valor, &valor, 1);
 	return UnitConvert(valor*4); /* Resistor divider for HCSR-04 */
 }
 
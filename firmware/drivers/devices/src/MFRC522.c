@@ -9,6 +9,8 @@
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
 #include "uart_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 
 #define SPI_BR 4000000				/*!< Frequency of sck for SPI communication */
@@ -30,6 +32,58 @@ spi_mcu_config_t spi_conf = {
 
 static spi_dev_t mfrc522_spi;							/*!< uC SPI port */
 static gpio_t mfrc522_dc, mfrc522_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
+static bool mfrc522_irq_enabled = false;	/*!< Command completion signaled by the IRQ pin */
+static TaskHandle_t mfrc522_irq_task = NULL;	/*!< Task waiting for command completion */
+static uint16_t mfrc522_timeout = 1000;		/*!< Timer reload for commands (25us ticks) */
+
+/*
+ * @brief: CRC_A lookup table (ISO 14443-3: x^16 + x^12 + x^5 + 1, LSB first)
+ */
+static const uint16_t crc_a_table[256] = {
+	0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+	0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+	0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+	0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+	0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+	0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+	0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+	0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+	0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+	0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+	0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+	0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+	0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+	0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+	0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+	0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+	0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+	0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+	0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+	0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+	0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+	0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+	0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+	0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+	0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+	0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+	0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+	0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+	0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+	0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+	0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+	0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78,
+};
+
+/**
+ * IRQ pin interrupt: wakes up the task waiting for the command to complete.
+ */
+static void PCD_IrqIsr(void *param) {
+	BaseType_t higher_prio_woken = pdFALSE;
+	if (mfrc522_irq_task != NULL) {
+		vTaskNotifyGiveFromISR(mfrc522_irq_task, &higher_prio_woken);
+		portYIELD_FROM_ISR(higher_prio_woken);
+	}
+}
 
 
 /**
@@ -70,30 +124,24 @@ void PCD_WriteRegister(
 	uint8_t reg,  ///< The register to write to. One of the PCD_Register enums.
 	uint8_t value ///< The value to write.
 	) {
-	SpiInit(&spi_conf);
-	
 	// Select slave
 	GPIOOff(mfrc522_dc);
-	
-	
+
 	// MSB == 0 is for writing. LSB is not used in address. Datasheet section
-	// 8.1.2.3.
-	// SPI.transfer(reg & 0x7E);
+	// 8.1.2.3. Address and value are sent in a single transfer.
 	mfrc->Tx_Buf[0] = (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
+	mfrc->Tx_Buf[1] = value;
+	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 2);
 
-
-	// SPI.transfer(value);
-	mfrc->Tx_Buf[0] = value;
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
 	// Release slave again
-    GPIOOn(mfrc522_dc);
-
+	GPIOOn(mfrc522_dc);
 } // End PCD_WriteRegister()
 
 /**
  * Writes a number of uint8_ts to the specified register in the MFRC522 chip.
  * The interface is described in the datasheet section 8.1.2.
+ * The address is sent once and the chip keeps writing the same register
+ * (i.e. the FIFO), so up to MFRC522_BURST_SIZE bytes go in one transfer.
  */
 void PCD_WriteNRegister(
 	MFRC522Ptr_t mfrc,
@@ -101,24 +149,43 @@ void PCD_WriteNRegister(
 	uint8_t count, ///< The number of uint8_ts to write to the register
 	uint8_t *values ///< The values to write. uint8_t array.
 	) {
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-	
-	// Select slave
-	GPIOOff(mfrc522_dc);
+	uint8_t n, i;
 
-	//	SPI.transfer(reg & 0x7E);
-	// MSB == 0 is for writing. LSB is not used in address. Datasheet section
-	// 8.1.2.3.
-	mfrc->Tx_Buf[0] = (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
+	while (count > 0) {
+		n = (count > MFRC522_BURST_SIZE) ? MFRC522_BURST_SIZE : count;
 
-	SpiWrite(mfrc522_spi, values, count);
-	
-	// Release slave again
-    GPIOOn(mfrc522_dc);
+		// MSB == 0 is for writing. LSB is not used in address. Datasheet
+		// section 8.1.2.3.
+		mfrc->Tx_Buf[0] = (reg & 0x7E);
+		for (i = 0; i < n; i++) {
+			mfrc->Tx_Buf[i + 1] = values[i];
+		}
 
-} // End PCD_WriteRegister()
+		// Select slave
+		GPIOOff(mfrc522_dc);
+		SpiWrite(mfrc522_spi, mfrc->Tx_Buf, n + 1);
+		// Release slave again
+		GPIOOn(mfrc522_dc);
+
+		values += n;
+		count -= n;
+	}
+} // End PCD_WriteNRegister()
+
+/**
+ * Writes a list of registers. Each write is a 2 bytes transfer (an SPI frame
+ * can only address one register when writing, datasheet section 8.1.2.3).
+ */
+void PCD_WriteRegisterList(
+	MFRC522Ptr_t mfrc,
+	const PCD_RegValue *list, ///< Registers and values, written in order.
+	uint8_t count			  ///< Number of registers in the list.
+	) {
+	uint8_t i;
+	for (i = 0; i < count; i++) {
+		PCD_WriteRegister(mfrc, list[i].reg, list[i].value);
+	}
+} // End PCD_WriteRegisterList()
 
 /**
  * Reads a uint8_t from the specified register in the MFRC522 chip.
@@ -128,34 +195,57 @@ uint8_t PCD_ReadRegister(
 	MFRC522Ptr_t mfrc,
 	uint8_t reg ///< The register to read from. One of the PCD_Register enums.
 	) {
-	uint8_t value;
-
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-	
 	// Select slave
 	GPIOOff(mfrc522_dc);
 
 	// MSB == 1 is for reading. LSB ==0, not used in address. Datasheet section
-	// 8.1.2.3.
-	//	SPI.transfer(0x80 | (reg & 0x7E));
+	// 8.1.2.3. The value comes back while sending 0 to stop reading.
 	mfrc->Tx_Buf[0] = 0x80 | (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-	// Read the value back. Send 0 to stop reading.
-	//	value = SPI.transfer(0);
-	mfrc->Tx_Buf[0] = 0x00;
-	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-	value = mfrc->Rx_Buf[0];
+	mfrc->Tx_Buf[1] = 0x00;
+	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 2);
 
 	// Release slave again
-    GPIOOn(mfrc522_dc);
-	return value;
+	GPIOOn(mfrc522_dc);
+	return mfrc->Rx_Buf[1];
 } // End PCD_ReadRegister()
 
+/**
+ * Reads a list of registers in a single transfer: the address of each
+ * register is sent while the value of the previous one is received
+ * (datasheet section 8.1.2.1).
+ */
+void PCD_ReadRegisterList(
+	MFRC522Ptr_t mfrc,
+	const uint8_t *regs, ///< The registers to read. PCD_Register enums.
+	uint8_t count,		 ///< Number of registers, MFRC522_BURST_SIZE max.
+	uint8_t *values		 ///< uint8_t array to store the values in.
+	) {
+	uint8_t i;
+
+	if (count == 0 || count > MFRC522_BURST_SIZE) {
+		return;
+	}
+	for (i = 0; i < count; i++) {
+		mfrc->Tx_Buf[i] = 0x80 | (regs[i] & 0x7E);
+	}
+	mfrc->Tx_Buf[count] = 0x00;
+
+	// Select slave
+	GPIOOff(mfrc522_dc);
+	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, count + 1);
+	// Release slave again
+	GPIOOn(mfrc522_dc);
+
+	for (i = 0; i < count; i++) {
+		values[i] = mfrc->Rx_Buf[i + 1];
+	}
+} // End PCD_ReadRegisterList()
+
 /**
  * Reads a number of uint8_ts from the specified register in the MFRC522 chip.
  * The interface is described in the datasheet section 8.1.2.
+ * The address is repeated while the values are received, so up to
+ * MFRC522_BURST_SIZE bytes (the whole FIFO) come in one transfer.
  */
 void PCD_ReadNRegister(
 	MFRC522Ptr_t mfrc,
@@ -164,70 +254,43 @@ void PCD_ReadNRegister(
 	uint8_t *values, ///< uint8_t array to store the values in.
 	uint8_t rxAlign ///< Only bit positions rxAlign..7 in values[0] are updated.
 	) {
-	//		 rxAlign=0;
-	if (count == 0) {
-		return;
-	}
-	// UartSendString(SERIAL_PORT_PC,F("Reading "));	UartSendString(SERIAL_PORT_PC,count); UartSendString(SERIAL_PORT_PC,F(" uint8_ts from
-	// register."));
 	uint8_t address = 0x80 | (reg & 0x7E); // MSB == 1 is for reading. LSB is
 										   // not used in address. Datasheet
 										   // section 8.1.2.3.
-	uint8_t index = 0;					   // Index in values array.
-
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-
-    // Select slave
-	GPIOOff(mfrc522_dc);
+	uint8_t n, i;
+	uint8_t first = 1;
 
-	// One read is performed outside of the loop
-	count--;
+	while (count > 0) {
+		n = (count > MFRC522_BURST_SIZE) ? MFRC522_BURST_SIZE : count;
 
-	// Tell MFRC522 which address we want to read
-	//	SPI.transfer(address);
-	mfrc->Tx_Buf[0] = address;
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
+		// Tell MFRC522 which address we want to read, and the same address
+		// again for each value but the last one. Send 0 to stop reading.
+		for (i = 0; i < n; i++) {
+			mfrc->Tx_Buf[i] = address;
+		}
+		mfrc->Tx_Buf[n] = 0;
 
+		// Select slave
+		GPIOOff(mfrc522_dc);
+		SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, n + 1);
+		// Release slave again
+		GPIOOn(mfrc522_dc);
 
-	while (index < count) {
-		if (index == 0 &&
-			rxAlign) { // Only update bit positions rxAlign..7 in values[0]
+		if (first && rxAlign) { // Only update bit positions rxAlign..7 in
+								// values[0]
 			// Create bit mask for bit positions rxAlign..7
-			uint8_t mask = 0;
-			uint8_t i;
-			for (i = rxAlign; i <= 7; i++) {
-				mask |= (1 << i);
-			}
-
-			// Read value and tell that we want to read the same address again.
-			//			uint8_t value = SPI.transfer(address);
-			mfrc->Tx_Buf[0] = address;
-			SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-			uint8_t value = mfrc->Rx_Buf[0];
-
-			// Apply mask to both current value of values[0] and the new data in
-			// value.
-			values[0] = (values[index] & ~mask) | (value & mask);
-		} else { // Normal case
-			// Read value and tell that we want to read the same address again.
-			//				values[index] = SPI.transfer(address);
-			mfrc->Tx_Buf[0] = address;
-			SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-			values[index] = mfrc->Rx_Buf[0];
+			uint8_t mask = (uint8_t)(0xFF << rxAlign);
+			// Apply mask to both current value of values[0] and the new data
+			mfrc->Rx_Buf[1] = (values[0] & ~mask) | (mfrc->Rx_Buf[1] & mask);
+		}
+		for (i = 0; i < n; i++) {
+			values[i] = mfrc->Rx_Buf[i + 1];
 		}
-		index++;
+		first = 0;
+		values += n;
+		count -= n;
 	}
-
-	// Read the final uint8_t. Send 0 to stop reading.
-	//	values[index] = SPI.transfer(0);
-	mfrc->Tx_Buf[0] = 0;
-	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-	values[index] = mfrc->Rx_Buf[0];
-
-	// Release slave again
-    GPIOOn(mfrc522_dc);
-} // End PCD_ReadRegister()
+} // End PCD_ReadNRegister()
 
 /**
  * Sets the bits given in mask in register reg.
@@ -256,52 +319,28 @@ void PCD_ClearRegisterBitMask(
 } // End PCD_ClearRegisterBitMask()
 
 /**
- * Use the CRC coprocessor in the MFRC522 to calculate a CRC_A.
+ * Calculates a CRC_A on the MCU with a lookup table, one byte per step.
+ * It used to be done by the CRC coprocessor of the MFRC522, which costs
+ * several SPI transfers plus polling DivIrqReg.
  *
- * @return STATUS_OK on success, STATUS_??? otherwise.
+ * @return STATUS_OK.
  */
 StatusCode
 PCD_CalculateCRC(MFRC522Ptr_t mfrc,
-				 uint8_t *data,  ///< In: Pointer to the data to transfer to the
-								 ///FIFO for CRC calculation.
-				 uint8_t length, ///< In: The number of uint8_ts to transfer.
+				 uint8_t *data,  ///< In: Pointer to the data to calculate the
+								 ///CRC of.
+				 uint8_t length, ///< In: The number of uint8_ts.
 				 uint8_t *result ///< Out: Pointer to result buffer. Result is
 								 ///written to result[0..1], low uint8_t first.
 				 ) {
-	PCD_WriteRegister(mfrc, CommandReg, PCD_Idle); // Stop any active command.
-	PCD_WriteRegister(mfrc, DivIrqReg,
-					  0x04); // Clear the CRCIRq interrupt request bit
-	PCD_SetRegisterBitMask(mfrc, FIFOLevelReg,
-						   0x80); // FlushBuffer = 1, FIFO initialization
-	PCD_WriteNRegister(mfrc, FIFODataReg, length,
-					   data);						  // Write data to the FIFO
-	PCD_WriteRegister(mfrc, CommandReg, PCD_CalcCRC); // Start the calculation
-
-	// Wait for the CRC calculation to complete. Each iteration of the
-	// while-loop takes 17.73�s.
-	uint16_t i = 5000;
-	uint8_t n;
-	while (1) {
-		n = PCD_ReadRegister(mfrc, DivIrqReg); // DivIrqReg[7..0] bits are: Set2
-											   // reserved reserved MfinActIRq
-											   // reserved CRCIRq reserved
-											   // reserved
-		if (n & 0x04) { // CRCIRq bit set - calculation done
-			break;
-		}
-		if (--i == 0) { // The emergency break. We will eventually terminate on
-						// this one after 89ms. Communication with the MFRC522
-						// might be down.
-			return STATUS_TIMEOUT;
-		}
-	}
-	PCD_WriteRegister(
-		mfrc, CommandReg,
-		PCD_Idle); // Stop calculating CRC for new content in the FIFO.
+	uint16_t crc = 0x6363; // Preset value (ISO 14443-3 part 6.2.4)
+	uint8_t i;
 
-	// Transfer the result from the registers to the result buffer
-	result[0] = PCD_ReadRegister(mfrc, CRCResultRegL);
-	result[1] = PCD_ReadRegister(mfrc, CRCResultRegH);
+	for (i = 0; i < length; i++) {
+		crc = (crc >> 8) ^ crc_a_table[(crc ^ data[i]) & 0xFF];
+	}
+	result[0] = crc & 0xFF;
+	result[1] = crc >> 8;
 	return STATUS_OK;
 } // End PCD_CalculateCRC()
 
@@ -317,6 +356,7 @@ void PCD_Init(MFRC522Ptr_t mfrc) {
 	/* SPI configuration */
 	spi_conf.device = mfrc->spi_dev;
 	mfrc522_spi = mfrc->spi_dev;
+	SpiInit(&spi_conf);
 	/* GPIOs configuration and initialization */
 	mfrc522_dc = mfrc->_chipSelectPin;
 	mfrc522_rst = mfrc->_resetPowerDownPin;
@@ -342,27 +382,22 @@ void PCD_Init(MFRC522Ptr_t mfrc) {
 	// [TPrescaler_Hi:TPrescaler_Lo].
 	// TPrescaler_Hi are the four low bits in TModeReg. TPrescaler_Lo is
 	// TPrescalerReg.
-	PCD_WriteRegister(mfrc, TModeReg, 0x80); // TAuto=1; timer starts
-											 // automatically at the end of the
-											 // transmission in all
-											 // communication modes at all
-											 // speeds
-	PCD_WriteRegister(mfrc, TPrescalerReg,
-					  0xA9); // TPreScaler = TModeReg[3..0]:TPrescalerReg, ie
-							 // 0x0A9 = 169 => f_timer=40kHz, ie a timer period
-							 // of 25�s.
-	PCD_WriteRegister(
-		mfrc, TReloadRegH,
-		0x03); // Reload timer with 0x3E8 = 1000, ie 25ms before timeout.
-	PCD_WriteRegister(mfrc, TReloadRegL, 0xE8);
-
-	PCD_WriteRegister(mfrc, TxASKReg, 0x40); // Default 0x00. Force a 100 % ASK
-											 // modulation independent of the
-											 // ModGsPReg register setting
-	PCD_WriteRegister(mfrc, ModeReg, 0x3D);  // Default 0x3F. Set the preset
-											// value for the CRC coprocessor for
-											// the CalcCRC command to 0x6363
-											// (ISO 14443-3 part 6.2.4)
+	const PCD_RegValue init[] = {
+		{TModeReg, 0x80},	  // TAuto=1; timer starts automatically at the end
+							  // of the transmission in all communication modes
+							  // at all speeds
+		{TPrescalerReg, 0xA9}, // TPreScaler = TModeReg[3..0]:TPrescalerReg, ie
+							   // 0x0A9 = 169 => f_timer=40kHz, ie a timer
+							   // period of 25us.
+		{TReloadRegH, 0x03},   // Reload timer with 0x3E8 = 1000, ie 25ms
+		{TReloadRegL, 0xE8},   // before timeout.
+		{TxASKReg, 0x40}, // Default 0x00. Force a 100 % ASK modulation
+						  // independent of the ModGsPReg register setting
+		{ModeReg, 0x3D},  // Default 0x3F. Set the preset value for the CRC
+						  // coprocessor for the CalcCRC command to 0x6363
+						  // (ISO 14443-3 part 6.2.4)
+	};
+	PCD_WriteRegisterList(mfrc, init, sizeof(init) / sizeof(init[0]));
 	PCD_AntennaOn(mfrc); // Enable the antenna driver pins TX1 and TX2 (they
 						 // were disabled by the reset)
 } // End PCD_Init()
@@ -434,6 +469,85 @@ void PCD_SetAntennaGain(MFRC522Ptr_t mfrc, uint8_t mask) {
 	}
 } // End PCD_SetAntennaGain()
 
+/**
+ * Routes command completion through the MFRC522 IRQ pin: the calling task
+ * sleeps until the pin interrupt instead of polling ComIrqReg over SPI.
+ * Must be called after PCD_Init(). Commands must be run from a task.
+ */
+void PCD_EnableIrq(
+	MFRC522Ptr_t mfrc,
+	gpio_t irqPin ///< uC GPIO connected to the IRQ pin of the MFRC522.
+	) {
+	GPIOInit(irqPin, GPIO_INPUT);
+	const PCD_RegValue irq[] = {
+		{ComIEnReg, 0x80}, // IRqInv = 1: IRQ pin active low, all sources off
+		{DivIEnReg, 0x80}, // IRQPushPull = 1: standard CMOS output
+	};
+	PCD_WriteRegisterList(mfrc, irq, sizeof(irq) / sizeof(irq[0]));
+	GPIOActivInt(irqPin, PCD_IrqIsr, false, NULL);
+	mfrc522_irq_enabled = true;
+} // End PCD_EnableIrq()
+
+/**
+ * Sets how long the timer waits for a PICC answer before a command fails
+ * with STATUS_TIMEOUT. PCD_Init() sets 25ms; PICCs answer within about 100us,
+ * so a few ms are enough for REQA/WUPA, anticollision and HLTA. MIFARE
+ * authentication and writes need longer.
+ */
+void PCD_SetTimeout(
+	MFRC522Ptr_t mfrc,
+	uint16_t ms ///< Timeout in ms, up to 1638.
+	) {
+	uint32_t ticks = (uint32_t)ms * 40; // 40kHz timer, see PCD_Init()
+	mfrc522_timeout = (ticks > 0xFFFF) ? 0xFFFF : ticks;
+	const PCD_RegValue reload[] = {
+		{TReloadRegH, mfrc522_timeout >> 8},
+		{TReloadRegL, mfrc522_timeout & 0xFF},
+	};
+	PCD_WriteRegisterList(mfrc, reload, 2);
+} // End PCD_SetTimeout()
+
+/**
+ * Blocks the calling task until the MFRC522 timer expires. With the IRQ pin
+ * enabled (PCD_EnableIrq()) the task sleeps until the timer interrupt, with
+ * no SPI traffic in between; otherwise it is a plain task delay.
+ */
+void PCD_WaitTimer(
+	MFRC522Ptr_t mfrc,
+	uint16_t ms ///< Time to wait in ms, up to 1638.
+	) {
+	if (!mfrc522_irq_enabled) {
+		vTaskDelay(pdMS_TO_TICKS(ms));
+		return;
+	}
+	uint32_t ticks = (uint32_t)ms * 40;
+	if (ticks > 0xFFFF) {
+		ticks = 0xFFFF;
+	}
+	mfrc522_irq_task = xTaskGetCurrentTaskHandle();
+	ulTaskNotifyTake(pdTRUE, 0);
+	const PCD_RegValue start[] = {
+		{CommandReg, PCD_Idle},  // Stop any active command.
+		{TModeReg, 0x00},		 // TAuto=0: started by software
+		{TReloadRegH, ticks >> 8},
+		{TReloadRegL, ticks & 0xFF},
+		{ComIrqReg, 0x7F},		 // Clear all seven interrupt request bits
+		{ComIEnReg, 0x81},		 // TimerIEn, IRQ pin active low
+		{ControlReg, 0x40},		 // TStartNow
+	};
+	PCD_WriteRegisterList(mfrc, start, sizeof(start) / sizeof(start[0]));
+	ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms + MFRC522_IRQ_TIMEOUT_MS));
+	mfrc522_irq_task = NULL;
+	const PCD_RegValue stop[] = {
+		{ComIEnReg, 0x80},		 // Release the IRQ pin
+		{ControlReg, 0x80},		 // TStopNow
+		{TModeReg, 0x80},		 // TAuto=1, see PCD_Init()
+		{TReloadRegH, mfrc522_timeout >> 8},
+		{TReloadRegL, mfrc522_timeout & 0xFF},
+	};
+	PCD_WriteRegisterList(mfrc, stop, sizeof(stop) / sizeof(stop[0]));
+} // End PCD_WaitTimer()
+
 /*******************************************************************************
 * Functions for communicating with PICCs
 *******************************************************************************/
@@ -508,27 +622,49 @@ StatusCode PCD_CommunicateWithPICC(
 		(rxAlign << 4) + txLastBits; // RxAlign = BitFramingReg[6..4].
 									 // TxLastBits = BitFramingReg[2..0]
 
-	PCD_WriteRegister(mfrc, CommandReg, PCD_Idle); // Stop any active command.
-	PCD_WriteRegister(mfrc, ComIrqReg,
-					  0x7F); // Clear all seven interrupt request bits
-	PCD_SetRegisterBitMask(mfrc, FIFOLevelReg,
-						   0x80); // FlushBuffer = 1, FIFO initialization
+	const PCD_RegValue start[] = {
+		{CommandReg, PCD_Idle}, // Stop any active command.
+		{ComIrqReg, 0x7F},		// Clear all seven interrupt request bits
+		{FIFOLevelReg, 0x80},   // FlushBuffer = 1, FIFO initialization
+	};
+	PCD_WriteRegisterList(mfrc, start, sizeof(start) / sizeof(start[0]));
 	PCD_WriteNRegister(mfrc, FIFODataReg, sendLen,
 					   sendData); // Write sendData to the FIFO
-	PCD_WriteRegister(mfrc, BitFramingReg, bitFraming); // Bit adjustments
-	PCD_WriteRegister(mfrc, CommandReg, command);		// Execute the command
+	PCD_RegValue exec[4];
+	uint8_t execLen = 0;
+	exec[execLen++] = (PCD_RegValue){BitFramingReg, bitFraming}; // Bit
+																   // adjustments
+	if (mfrc522_irq_enabled) {
+		// Success and timer interrupts drive the IRQ pin (active low)
+		mfrc522_irq_task = xTaskGetCurrentTaskHandle();
+		ulTaskNotifyTake(pdTRUE, 0);
+		exec[execLen++] = (PCD_RegValue){ComIEnReg, 0x80 | waitIRq | 0x01};
+	}
+	exec[execLen++] = (PCD_RegValue){CommandReg, command}; // Execute the command
 	if (command == PCD_Transceive) {
-		PCD_SetRegisterBitMask(
-			mfrc, BitFramingReg,
-			0x80); // StartSend=1, transmission of data starts
+		// StartSend=1, transmission of data starts
+		exec[execLen++] = (PCD_RegValue){BitFramingReg, 0x80 | bitFraming};
 	}
+	PCD_WriteRegisterList(mfrc, exec, execLen);
 
 	// Wait for the command to complete.
 	// In PCD_Init() we set the TAuto flag in TModeReg. This means the timer
 	// automatically starts when the PCD stops transmitting.
+	if (mfrc522_irq_enabled) {
+		// The timer interrupt fires after 25ms; the notification timeout is
+		// the emergency break in case communication with the MFRC522 is down.
+		uint32_t notified =
+			ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MFRC522_IRQ_TIMEOUT_MS));
+		n = PCD_ReadRegister(mfrc, ComIrqReg);
+		PCD_WriteRegister(mfrc, ComIEnReg, 0x80); // Release the IRQ pin
+		mfrc522_irq_task = NULL;
+		if (!notified || !(n & waitIRq)) { // Timer interrupt or no answer
+			return STATUS_TIMEOUT;
+		}
+	}
 	// Each iteration of the do-while-loop takes 17.86�s.
 	i = 2000;
-	while (1) {
+	while (!mfrc522_irq_enabled) {
 		n = PCD_ReadRegister(mfrc, ComIrqReg); // ComIrqReg[7..0] bits are: Set1
 											   // TxIRq RxIRq IdleIRq HiAlertIRq
 											   // LoAlertIRq ErrIRq TimerIRq
@@ -546,9 +682,13 @@ StatusCode PCD_CommunicateWithPICC(
 		}
 	}
 
+	// Error, FIFO level and last bits are read in a single transfer.
+	const uint8_t status_regs[] = {ErrorReg, FIFOLevelReg, ControlReg};
+	uint8_t status_values[3];
+	PCD_ReadRegisterList(mfrc, status_regs, 3, status_values);
+
 	// Stop now if any errors except collisions were detected.
-	uint8_t errorRegValue =
-		PCD_ReadRegister(mfrc, ErrorReg); // ErrorReg[7..0] bits are: WrErr
+	uint8_t errorRegValue = status_values[0]; // ErrorReg[7..0] bits are: WrErr
 										  // TempErr reserved BufferOvfl CollErr
 										  // CRCErr ParityErr ProtocolErr
 	if (errorRegValue & 0x13) {			  // BufferOvfl ParityErr ProtocolErr
@@ -557,15 +697,14 @@ StatusCode PCD_CommunicateWithPICC(
 
 	// If the caller wants data back, get it from the MFRC522.
 	if (backData && backLen) {
-		n = PCD_ReadRegister(mfrc,
-							 FIFOLevelReg); // Number of uint8_ts in the FIFO
+		n = status_values[1]; // Number of uint8_ts in the FIFO
 		if (n > *backLen) {
 			return STATUS_NO_ROOM;
 		}
 		*backLen = n; // Number of uint8_ts returned
 		PCD_ReadNRegister(mfrc, FIFODataReg, n, backData,
 						  rxAlign); // Get received data from FIFO
-		_validBits = PCD_ReadRegister(mfrc, ControlReg) &
+		_validBits = status_values[2] &
 					 0x07; // RxLastBits[2:0] indicates the number of valid bits
 						   // in the last received uint8_t. If this value is
 						   // 000b, the whole uint8_t is valid.
@@ -50,6 +50,7 @@
  * -----------------------------------------------------------
  * 20210901 v0.1 initials initial version Maria Casablanca
  * 20242703 v1.1 converted to ESP IDF by JC
+ * 20261019 v1.2 calibrated conversion to mV (analog_io_mcu table)
  */
 
 /*==================[inclusions]=============================================*/
@@ -103,6 +104,7 @@ float Si7007MeasureTemperature(void){
 	float valor = 0;
 	
 	AnalogInputReadSingle(temp_config.input, &value);
+	AnalogInputToMillivolts(temp_config.input, &value, &value, 1);
 	valor = (value/1000.0)/V_REF;
 	temperature = -46.85 + (valor*175.71);
 	return temperature;
@@ -116,6 +118,7 @@ float Si7007MeasureHumidity(void){
 	float valor = 0;
 	
 	AnalogInputReadSingle(hum_config.input, &value);
+	AnalogInputToMillivolts(hum_config.input, &value, &value, 1);
 	valor = (value/1000.0)/V_REF;
 	humidity = -6 + (valor*125);
 	return humidity;
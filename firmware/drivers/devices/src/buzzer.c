@@ -13,12 +13,37 @@
 #include "buzzer.h"
 #include "delay_mcu.h"
 #include "pwm_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 /*==================[macros and definitions]=================================*/
 #define PWM_BUZZER      PWM_3
 #define PWM_DC          50
 #define OCTAVE_OFFSET   0
+#define SEQ_STACK_SIZE  2048
+#define SEQ_TASK_PRIO   6
 /*==================[internal data declaration]==============================*/
+/**
+ * @brief RTTTL default values (from the melody header)
+ */
+typedef struct {
+    uint8_t dur;        /*!< Default note duration */
+    uint8_t oct;        /*!< Default octave */
+    long wholenote;     /*!< Whole note duration (in ms) */
+} rtttl_header_t;
+
+/**
+ * @brief Commands sent to the sequencer task
+ */
+typedef enum {
+    SEQ_PLAY,
+    SEQ_STOP
+} seq_cmd_type_t;
 
+typedef struct {
+    seq_cmd_type_t type;
+    buzzer_melody_t melody;
+} seq_cmd_t;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -29,6 +54,10 @@ uint16_t notes[] = {
     NOTE_C6, NOTE_CS6, NOTE_D6, NOTE_DS6, NOTE_E6, NOTE_F6, NOTE_FS6, NOTE_G6, NOTE_GS6, NOTE_A6, NOTE_AS6, NOTE_B6,
     NOTE_C7, NOTE_CS7, NOTE_D7, NOTE_DS7, NOTE_E7, NOTE_F7, NOTE_FS7, NOTE_G7, NOTE_GS7, NOTE_A7, NOTE_AS7, NOTE_B7
 };
+static QueueHandle_t seq_queue = NULL;              /*!< Commands for the sequencer task */
+static buzzer_melody_t seq_pending[BUZZER_QUEUE_LEN]; /*!< Melodies waiting to be played */
+static uint8_t seq_n_pending = 0;
+static volatile bool seq_playing = false;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
@@ -39,42 +68,13 @@ bool isDigit(char c){
         return false;
     }
 }
-/*==================[external functions definition]==========================*/
-void BuzzerInit(gpio_t pin){
-    PWMInit(PWM_BUZZER, pin, NOTE_C4);
-    PWMSetDutyCycle(PWM_BUZZER, PWM_DC);
-    PWMOff(PWM_BUZZER);
-}
-
-void BuzzerOn(void){
-    PWMOn(PWM_BUZZER);
-}
 
-void BuzzerOff(void){
-    PWMOff(PWM_BUZZER);
-}
-
-void BuzzerSetFrec(uint16_t freq){
-    PWMSetFreq(PWM_BUZZER, freq);
-}
-
-void BuzzerPlayTone(uint16_t freq, uint16_t duration){
-	PWMSetFreq(PWM_BUZZER, freq);
-	PWMOn(PWM_BUZZER);
-	DelayMs(duration);
-	PWMOff(PWM_BUZZER);
-}
-
-void BuzzerPlayRtttl(const char * rtttl_melody){
-    uint8_t default_dur = 4;
-    uint8_t default_oct = 6;
+static const char * RtttlParseHeader(const char * rtttl_melody, rtttl_header_t * header){
     int bpm = 63;
     int num;
-    long wholenote;
-    long duration;
-    uint8_t note;
-    uint8_t scale;
 
+    header->dur = 4;
+    header->oct = 6;
     /* find the start (skip name, etc) */
     while(*rtttl_melody != ':') rtttl_melody++; // ignore name
     rtttl_melody++;                             // skip ':'
@@ -87,7 +87,7 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
         while(isDigit(*rtttl_melody)){
         num = (num * 10) + (*rtttl_melody++ - '0');
         }
-        if(num > 0) default_dur = num;
+        if(num > 0) header->dur = num;
         rtttl_melody++;     // skip comma
     }
 
@@ -96,7 +96,7 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
         rtttl_melody++; 
         rtttl_melody++;     // skip "o="
         num = *rtttl_melody++ - '0';
-        if(num >= 3 && num <=7) default_oct = num;
+        if(num >= 3 && num <=7) header->oct = num;
         rtttl_melody++;     // skip comma
     }
 
@@ -113,81 +113,272 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
     }
 
     /* BPM usually expresses the number of quarter notes per minute */
-    wholenote = (60 * 1000L / bpm) * 4;  // this is the time for whole note (in milliseconds)
+    header->wholenote = (60 * 1000L / bpm) * 4;  // this is the time for whole note (in milliseconds)
+    return rtttl_melody;
+}
 
-    /* now begin note loop */
-    while(*rtttl_melody){
-        /* first, get note duration, if available */
-        num = 0;
-        while(isDigit(*rtttl_melody)){
-            num = (num * 10) + (*rtttl_melody++ - '0');
-        }
-        if(num){
-            duration = wholenote / num;
-        }else{
-            duration = wholenote / default_dur;  // we will need to check if we are a dotted note after
-        } 
-        /* now get the note */
+static const char * RtttlParseNote(const char * rtttl_melody, const rtttl_header_t * header, buzzer_note_t * out){
+    int num;
+    long duration;
+    uint8_t note;
+    uint8_t scale;
+
+    /* first, get note duration, if available */
+    num = 0;
+    while(isDigit(*rtttl_melody)){
+        num = (num * 10) + (*rtttl_melody++ - '0');
+    }
+    if(num){
+        duration = header->wholenote / num;
+    }else{
+        duration = header->wholenote / header->dur;  // we will need to check if we are a dotted note after
+    } 
+    /* now get the note */
+    note = 0;
+    switch(*rtttl_melody){
+    case 'c':
+        note = 1;
+        break;
+    case 'd':
+        note = 3;
+        break;
+    case 'e':
+        note = 5;
+        break;
+    case 'f':
+        note = 6;
+        break;
+    case 'g':
+        note = 8;
+        break;
+    case 'a':
+        note = 10;
+        break;
+    case 'b':
+        note = 12;
+        break;
+    case 'p':
+    default:
         note = 0;
-        switch(*rtttl_melody){
-        case 'c':
-            note = 1;
-            break;
-        case 'd':
-            note = 3;
-            break;
-        case 'e':
-            note = 5;
-            break;
-        case 'f':
-            note = 6;
-            break;
-        case 'g':
-            note = 8;
-            break;
-        case 'a':
-            note = 10;
-            break;
-        case 'b':
-            note = 12;
-            break;
-        case 'p':
-        default:
-            note = 0;
-        }
+    }
+    rtttl_melody++;
+    /* now, get optional '#' sharp */
+    if(*rtttl_melody == '#'){
+        note++;
+        rtttl_melody++;
+    }
+    /* now, get optional '.' dotted note */
+    if(*rtttl_melody == '.'){
+        duration += duration/2;
+        rtttl_melody++;
+    }
+    /* now, get scale */
+    if(isDigit(*rtttl_melody)){
+        scale = *rtttl_melody - '0';
         rtttl_melody++;
-        /* now, get optional '#' sharp */
-        if(*rtttl_melody == '#'){
-            note++;
-            rtttl_melody++;
+    }else{
+        scale = header->oct;
+    }
+    scale += OCTAVE_OFFSET;
+
+    if(*rtttl_melody == ','){
+        rtttl_melody++; // skip comma for next note (or we may be at the end)
+    }
+    out->freq = note ? notes[(scale - 4) * 12 + note] : 0;
+    out->duration = duration;
+    return rtttl_melody;
+}
+
+static void SeqMelodyEnd(buzzer_melody_t * melody){
+    if(melody->func_p != NULL){
+        ((void (*)(void *))melody->func_p)(melody->param_p);
+    }
+}
+
+/**
+ * @brief Takes the oldest melody with the highest priority from the pending list.
+ */
+static bool SeqPopPending(buzzer_melody_t * melody){
+    uint8_t best = 0;
+    if(seq_n_pending == 0){
+        return false;
+    }
+    for(uint8_t i = 1; i < seq_n_pending; i++){
+        if(seq_pending[i].prio > seq_pending[best].prio){
+            best = i;
         }
-        /* now, get optional '.' dotted note */
-        if(*rtttl_melody == '.'){
-            duration += duration/2;
-            rtttl_melody++;
+    }
+    *melody = seq_pending[best];
+    seq_n_pending--;
+    for(uint8_t i = best; i < seq_n_pending; i++){
+        seq_pending[i] = seq_pending[i + 1];
+    }
+    return true;
+}
+
+static void SeqTask(void *pvParameter){
+    seq_cmd_t cmd;
+    buzzer_melody_t current;
+    uint16_t index = 0;
+    TickType_t note_end = 0;
+    TickType_t wait = portMAX_DELAY;
+    bool start_note;
+
+    while(true){
+        start_note = false;
+        if(xQueueReceive(seq_queue, &cmd, wait) == pdTRUE){
+            if(cmd.type == SEQ_STOP){
+                PWMOff(PWM_BUZZER);
+                if(seq_playing){
+                    SeqMelodyEnd(&current);
+                }
+                while(SeqPopPending(&current)){
+                    SeqMelodyEnd(&current);
+                }
+                seq_playing = false;
+            }else if(!seq_playing || (cmd.melody.prio >= current.prio)){
+                if(seq_playing){
+                    SeqMelodyEnd(&current);
+                }
+                current = cmd.melody;
+                index = 0;
+                seq_playing = true;
+                start_note = true;
+            }else if(seq_n_pending < BUZZER_QUEUE_LEN){
+                seq_pending[seq_n_pending++] = cmd.melody;
+            }else{
+                SeqMelodyEnd(&cmd.melody);
+            }
+        }else if(seq_playing){
+            /* current note finished */
+            index++;
+            if(index >= current.n_notes){
+                if(current.loop){
+                    index = 0;
+                }else{
+                    PWMOff(PWM_BUZZER);
+                    SeqMelodyEnd(&current);
+                    seq_playing = SeqPopPending(&current);
+                    index = 0;
+                }
+            }
+            start_note = seq_playing;
         }
-        /* now, get scale */
-        if(isDigit(*rtttl_melody)){
-            scale = *rtttl_melody - '0';
-            rtttl_melody++;
-        }else{
-            scale = default_oct;
+
+        if(start_note){
+            if(current.n_notes == 0){
+                /* nothing to play: finish on next timeout */
+                note_end = xTaskGetTickCount();
+                current.loop = false;
+            }else{
+                if(current.notes[index].freq){
+                    PWMSetFreq(PWM_BUZZER, current.notes[index].freq);
+                    PWMOn(PWM_BUZZER);
+                }else{
+                    PWMOff(PWM_BUZZER);
+                }
+                note_end = xTaskGetTickCount() + pdMS_TO_TICKS(current.notes[index].duration);
+            }
         }
-        scale += OCTAVE_OFFSET;
 
-        if(*rtttl_melody == ','){
-            rtttl_melody++; // skip comma for next note (or we may be at the end)
+        if(seq_playing){
+            TickType_t now = xTaskGetTickCount();
+            wait = ((int32_t)(note_end - now) > 0) ? (note_end - now) : 0;
+        }else{
+            wait = portMAX_DELAY;
         }
+    }
+}
+/*==================[external functions definition]==========================*/
+void BuzzerInit(gpio_t pin){
+    PWMInit(PWM_BUZZER, pin, NOTE_C4);
+    PWMSetDutyCycle(PWM_BUZZER, PWM_DC);
+    PWMOff(PWM_BUZZER);
+}
+
+void BuzzerOn(void){
+    PWMOn(PWM_BUZZER);
+}
+
+void BuzzerOff(void){
+    PWMOff(PWM_BUZZER);
+}
+
+void BuzzerSetFrec(uint16_t freq){
+    PWMSetFreq(PWM_BUZZER, freq);
+}
+
+void BuzzerPlayTone(uint16_t freq, uint16_t duration){
+	PWMSetFreq(PWM_BUZZER, freq);
+	PWMOn(PWM_BUZZER);
+	DelayMs(duration);
+	PWMOff(PWM_BUZZER);
+}
+
+void BuzzerPlayRtttl(const char * rtttl_melody){
+    rtttl_header_t header;
+    buzzer_note_t note;
+
+    rtttl_melody = RtttlParseHeader(rtttl_melody, &header);
+    /* now begin note loop */
+    while(*rtttl_melody){
+        rtttl_melody = RtttlParseNote(rtttl_melody, &header, &note);
         /* now play the note */
-        if(note){
-            BuzzerPlayTone(notes[(scale - 4) * 12 + note], duration);
+        if(note.freq){
+            BuzzerPlayTone(note.freq, note.duration);
         }
         else{
-            DelayMs(duration);
+            DelayMs(note.duration);
         }
     }
 }
 
+uint16_t BuzzerCompileRtttl(const char * rtttl_melody, buzzer_note_t * note_table, uint16_t max_notes){
+    rtttl_header_t header;
+    uint16_t n_notes = 0;
+
+    rtttl_melody = RtttlParseHeader(rtttl_melody, &header);
+    while(*rtttl_melody && (n_notes < max_notes)){
+        rtttl_melody = RtttlParseNote(rtttl_melody, &header, &note_table[n_notes]);
+        n_notes++;
+    }
+    return n_notes;
+}
+
+void BuzzerSequencerInit(void){
+    if(seq_queue != NULL){
+        return;
+    }
+    seq_queue = xQueueCreate(BUZZER_QUEUE_LEN, sizeof(seq_cmd_t));
+    configASSERT(seq_queue);
+    xTaskCreate(SeqTask, "buzzer_seq", SEQ_STACK_SIZE, NULL, SEQ_TASK_PRIO, NULL);
+}
+
+bool BuzzerPlayAsync(const buzzer_melody_t * melody){
+    seq_cmd_t cmd = {
+        .type = SEQ_PLAY,
+        .melody = *melody
+    };
+    if(seq_queue == NULL){
+        return false;
+    }
+    return (xQueueSend(seq_queue, &cmd, 0) == pdTRUE);
+}
+
+void BuzzerStop(void){
+    seq_cmd_t cmd = {
+        .type = SEQ_STOP
+    };
+    if(seq_queue == NULL){
+        return;
+    }
+    xQueueSend(seq_queue, &cmd, portMAX_DELAY);
+}
+
+bool BuzzerIsPlaying(void){
+    return seq_playing;
+}
+
 void BuzzerDeinit(void){
     
 }
@@ -12,8 +12,13 @@
 #include "hx711.h"
 
 #include <delay_mcu.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 /*==================[macros and definitions]=================================*/
+#define HX711_DATA_BITS		24
+#define HX711_TASK_STACK	2048
+#define HX711_TASK_PRIO		10
 
 /*==================[internal data declaration]==============================*/
 uint8_t GAIN;		             /*!<  Amplification factor */
@@ -24,6 +29,17 @@ float SCALE;	                 /*!<  Used to return weight in grams, kg, ounces,
 gpio_t internal_pd_sck;
 gpio_t internal_dout;
 
+static TaskHandle_t stream_task_handle = NULL;
+static portMUX_TYPE stream_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool stream_on = false;
+static volatile bool stream_busy = false;	/*!<  Readout in progress: DOUT edges are data, not "ready" */
+static uint32_t stream_ring[HX711_RING_LEN];
+static uint8_t stream_head = 0;				/*!<  Next position to write */
+static uint8_t stream_unread = 0;			/*!<  Samples not yet returned by HX711_streamRead() */
+static uint8_t stream_avg_len = 1;
+static uint8_t stream_avg_count = 0;		/*!<  Samples in the moving average (until the window fills) */
+static uint64_t stream_sum = 0;				/*!<  Running sum of the moving average window */
+
 /*==================[internal functions declaration]=========================*/
 
 uint8_t shiftIn(void)
@@ -39,6 +55,89 @@ uint8_t shiftIn(void)
     return value;
 }
 
+/**
+ * @brief Converts the raw 24 bit conversion to the format returned by HX711_read().
+ * 
+ * Both the blocking and the streaming paths go through here, so OFFSET and SCALE 
+ * calibrated with one of them are valid for the other.
+ */
+static uint32_t HX711_toSample(uint32_t count)
+{
+	return (count >> 6) ^ 0x800000;
+}
+
+/**
+ * @brief Clocks out a full conversion (24 data bits plus the gain/channel pulses).
+ * 
+ * Runs with interrupts disabled: PD_SCK high for more than 60 us would power down the chip.
+ * The GPIO driver call itself is longer than the 0.2 us minimum pulse width, so no delays are needed.
+ */
+static uint32_t HX711_shiftConversion(void)
+{
+	uint32_t count = 0;
+
+	portENTER_CRITICAL(&stream_mux);
+	for (uint8_t i = 0; i < HX711_DATA_BITS; i++)
+	{
+		GPIOOn(internal_pd_sck);
+		GPIOOff(internal_pd_sck);
+		count = (count << 1) | GPIORead(internal_dout);
+	}
+	for (uint8_t i = 0; i < GAIN; i++)
+	{
+		GPIOOn(internal_pd_sck);
+		GPIOOff(internal_pd_sck);
+	}
+	portEXIT_CRITICAL(&stream_mux);
+	return HX711_toSample(count);
+}
+
+static void HX711_streamPush(uint32_t sample)
+{
+	portENTER_CRITICAL(&stream_mux);
+	if (stream_avg_count == stream_avg_len)
+	{
+		/* drop the oldest sample of the window */
+		stream_sum -= stream_ring[(stream_head + HX711_RING_LEN - stream_avg_len) % HX711_RING_LEN];
+	}
+	else
+	{
+		stream_avg_count++;
+	}
+	stream_ring[stream_head] = sample;
+	stream_sum += sample;
+	stream_head = (stream_head + 1) % HX711_RING_LEN;
+	if (stream_unread < HX711_RING_LEN)
+	{
+		stream_unread++;
+	}
+	portEXIT_CRITICAL(&stream_mux);
+}
+
+static void HX711_streamTask(void *pvParameter)
+{
+	while (true)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if (stream_on)
+		{
+			HX711_streamPush(HX711_shiftConversion());
+		}
+		stream_busy = false;
+	}
+}
+
+static void HX711_doutIsr(void *param)
+{
+	BaseType_t higher_prio_woken = pdFALSE;
+	if (stream_on && !stream_busy)
+	{
+		stream_busy = true;
+		vTaskNotifyGiveFromISR(stream_task_handle, &higher_prio_woken);
+		portYIELD_FROM_ISR(higher_prio_woken);
+	}
+}
+
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
@@ -105,13 +204,15 @@ uint32_t HX711_read(void)
         if(GPIORead(internal_dout))
             count++;
     }
-    count = count>>6;
-    GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
-    DelayUs(1);
-    GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
-    DelayUs(1);
-    count ^= 0x800000;
-    return(count);
+    // gain/channel of the next conversion, same pulses as the streaming path
+    for(i=0;i<GAIN;i++)
+    {
+    	 GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
+    	 DelayUs(1);
+        GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+        DelayUs(1);
+    }
+    return HX711_toSample(count);
 }
 
 uint32_t HX711_readAverage(uint8_t times)
@@ -161,6 +262,78 @@ double HX711_getOffset(void)
 	return OFFSET;
 }
 
+void HX711_streamStart(uint8_t avg_len)
+{
+	if (avg_len == 0)
+	{
+		avg_len = 1;
+	}
+	else if (avg_len > HX711_RING_LEN)
+	{
+		avg_len = HX711_RING_LEN;
+	}
+	portENTER_CRITICAL(&stream_mux);
+	stream_avg_len = avg_len;
+	stream_avg_count = 0;
+	stream_sum = 0;
+	stream_head = 0;
+	stream_unread = 0;
+	portEXIT_CRITICAL(&stream_mux);
+
+	if (stream_task_handle == NULL)
+	{
+		xTaskCreate(HX711_streamTask, "hx711", HX711_TASK_STACK, NULL, HX711_TASK_PRIO, &stream_task_handle);
+	}
+	GPIOActivInt(internal_dout, HX711_doutIsr, false, NULL);
+	stream_busy = false;
+	stream_on = true;
+	if (HX711_isReady())
+	{
+		/* a conversion is already waiting: its falling edge was missed */
+		stream_busy = true;
+		xTaskNotifyGive(stream_task_handle);
+	}
+}
+
+void HX711_streamStop(void)
+{
+	stream_on = false;
+	GPIODeactivInt(internal_dout);
+}
+
+uint8_t HX711_streamRead(uint32_t *samples, uint8_t max)
+{
+	uint8_t n;
+
+	portENTER_CRITICAL(&stream_mux);
+	n = (stream_unread < max) ? stream_unread : max;
+	for (uint8_t i = 0; i < n; i++)
+	{
+		samples[i] = stream_ring[(stream_head + HX711_RING_LEN - stream_unread + i) % HX711_RING_LEN];
+	}
+	stream_unread -= n;
+	portEXIT_CRITICAL(&stream_mux);
+	return n;
+}
+
+uint32_t HX711_streamAverage(void)
+{
+	uint32_t avg = 0;
+
+	portENTER_CRITICAL(&stream_mux);
+	if (stream_avg_count)
+	{
+		avg = stream_sum / stream_avg_count;
+	}
+	portEXIT_CRITICAL(&stream_mux);
+	return avg;
+}
+
+float HX711_streamUnits(void)
+{
+	return (HX711_streamAverage() - OFFSET) / SCALE;
+}
+
 void HX711_powerDown(void)
 {
 	GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
@@ -22,7 +22,12 @@
 #define MAX_PIXEL 320*240*2			/*!< Maximum number of bytes to write on LCD */
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
-#define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#define BURST_SIZE 1024				/*!< Size of the buffer used to stream pixels to the LCD */
+#define POLY_MAX_VERTICES 16		/*!< Maximum number of vertices of a filled polygon */
+#define SPI_MAX_TRANSFER 4092		/*!< Maximum length of a single SPI transfer (see spi_mcu.c) */
+#define STRING_MAX_CHARS 64			/*!< Maximum length of a string drawn in a single burst */
+#define PIC_RUN_FLAG 0x80			/*!< Run of a single palette index (compressed pictures) */
+#define PIC_RUN_MSK 0x7F			/*!< Number of pixels minus one (compressed pictures) */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
@@ -40,6 +45,9 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define NORMAL_MODE_ON		0x13 	/*!< Returns to normal mode (exits vertical scrolling mode) */
+#define V_SCROLL_DEF		0x33 	/*!< Defines the vertical scrolling area of the display */
+#define V_SCROLL_START		0x37 	/*!< Defines which line of the frame memory is shown at the top of the scrolling area */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
@@ -82,6 +90,32 @@ typedef struct {
     uint32_t databytes; 	/*!< Number of bytes of data to transmit */
     uint8_t *data;			/*!< Pointer to data or parameters array */
 } lcd_cmd_t;
+
+/**
+ * @brief Polygon edge stepped one row at a time with integer arithmetic (DDA)
+ */
+typedef struct {
+	int16_t x;				/*!< x at the current row */
+	int16_t y_top;			/*!< First row */
+	int16_t y_bottom;		/*!< Last row */
+	int16_t step;			/*!< Integer part of dx/dy */
+	int16_t rem;			/*!< Remainder of dx/dy (absolute value) */
+	int16_t err;			/*!< Accumulated remainder */
+	int8_t sign;			/*!< x direction */
+} edge_t;
+
+/**
+ * @brief Glyph stored in cache, already expanded to RGB565
+ */
+typedef struct {
+	const Font_t *font;		/*!< Font of the glyph */
+	char data;				/*!< Character */
+	uint16_t foreground;	/*!< Foreground color */
+	uint16_t background;	/*!< Background color */
+	uint16_t offset;		/*!< Position in cache arena (bytes) */
+	uint16_t size;			/*!< Size in cache arena (bytes) */
+	uint32_t stamp;			/*!< Last drawing operation that used the glyph */
+} glyph_entry_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -114,6 +148,50 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Starts writing LCD memory. Pixels are buffered and sent in bursts
+ * @retval 		None
+ */
+static void PixelStreamBegin(void);
+
+/**
+ * @brief  		Adds a pixel to the stream
+ * @param[in]	color: Pixel color (RGB565)
+ * @retval 		None
+ */
+static void PixelStreamPut(uint16_t color);
+
+/**
+ * @brief  		Adds already formatted pixels (2 bytes/pixel, high byte first) to the stream
+ * @param[in]	data: Pointer to pixels
+ * @param[in]	bytes_count: Number of bytes
+ * @retval 		None
+ */
+static void PixelStreamCopy(const uint8_t *data, uint32_t bytes_count);
+
+/**
+ * @brief  		Sends the pixels left in the stream buffer
+ * @retval 		None
+ */
+static void PixelStreamEnd(void);
+
+/**
+ * @brief  		Returns a glyph expanded to RGB565 from cache, expanding it if it's not there
+ * @note		Glyphs used in the current drawing operation are never evicted
+ * @param[in]  	font: Pointer to used font
+ * @param[in] 	data: Character
+ * @param[in]  	foreground: Color for char (RGB565)
+ * @param[in]  	background: Color for char background (RGB565)
+ * @retval 		Pointer to glyph pixels, NULL if it doesn't fit in cache
+ */
+static const uint8_t * GlyphCacheGet(Font_t *font, char data, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Looks up a glyph in cache, without expanding it nor evicting others
+ * @retval 		Pointer to glyph pixels, NULL if it's not in cache
+ */
+static const uint8_t * GlyphCacheFind(Font_t *font, char data, uint16_t foreground, uint16_t background);
+
 /*==================[internal data definition]===============================*/
 /**
  * @brief Initial LCD configuration parameters
@@ -191,6 +269,24 @@ static orientation_properties_t lcd_orientation = {
 		ILI9341_Portrait_1
 };	/*!< Default orientation configuration */
 
+static uint8_t stream_buf[2][BURST_SIZE];	/*!< Pixel stream buffers (one is filled while the other is sent) */
+static uint8_t fill_buf[BURST_SIZE];			/*!< Solid color burst, refilled only when the color changes */
+static uint16_t fill_color;					/*!< Color in fill_buf */
+static bool fill_valid = false;				/*!< fill_buf holds fill_color */
+static uint8_t stream_idx = 0;				/*!< Pixel stream buffer being filled */
+static uint32_t stream_len;					/*!< Bytes in pixel stream buffer */
+
+static uint8_t glyph_arena[ILI9341_GLYPH_CACHE_SIZE];			/*!< Glyph cache data, entries are packed in order */
+static glyph_entry_t glyph_cache[ILI9341_GLYPH_CACHE_ENTRIES];	/*!< Glyph cache entries */
+static uint8_t glyph_count = 0;				/*!< Glyphs in cache */
+static uint32_t glyph_used = 0;				/*!< Bytes used in cache arena */
+static uint32_t glyph_op = 0;				/*!< Drawing operation counter (LRU stamp) */
+
+static uint16_t scroll_top;					/*!< First frame memory line of the scrolling area */
+static uint16_t scroll_len;					/*!< Frame memory lines of the scrolling area */
+static uint16_t scroll_start;				/*!< Frame memory line shown at the top of the scrolling area */
+static bool scroll_flip;					/*!< Screen coordinates grow opposite to frame memory lines */
+
 /*==================[internal functions definition]==========================*/
 
 void WriteLCD(lcd_cmd_t * data){
@@ -232,39 +328,327 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 }
 
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	static uint16_t i;
-	static int32_t bytes_count;
-	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint32_t bytes_count, n, i;
+	uint16_t aux;
 
-	x_dist = x1 - x0;
-	y_dist = y1 - y0;
 	if (x0 > x1){
-		x_dist = - x_dist;
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
 	}
 	if (y0 > y1){
-		y_dist = - y_dist;
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Clip to the screen */
+	if (x0 >= lcd_orientation.width || y0 >= lcd_orientation.height){
+		return;
+	}
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
 	}
 	/* Number of bytes to write. We have to write 2 bytes/pixel (16bits color) */
-	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
+	bytes_count = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1) * 2;
+
+	if (!fill_valid || fill_color != color){
+		/* Wait for a fill in progress before changing the buffer */
+		SpiWaitQueued(ili9341_spi);
+		for (i = 0; i < BURST_SIZE; i += 2){
+			fill_buf[i] = HighByte(color);
+			fill_buf[i + 1] = LowByte(color);
+		}
+		fill_color = color;
+		fill_valid = true;
+	}
 	/* Define area to fill */
 	SetCursorPosition(x0, y0, x1, y1);
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+	GPIOOn(ili9341_dc);
+	/* The same buffer is queued again and again: each burst is queued as soon as the previous one ends */
+	while (bytes_count){
+		n = (bytes_count > BURST_SIZE) ? BURST_SIZE : bytes_count;
+		SpiWriteQueued(ili9341_spi, fill_buf, n);
+		bytes_count -= n;
+	}
+	SpiWaitQueued(ili9341_spi);
+}
 
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
+/**
+ * @brief  		Fills a horizontal span, clipped to the screen
+ */
+static void Span(int16_t x0, int16_t x1, int16_t y, uint16_t color){
+	int16_t aux;
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
 	}
-	/* Start writing LCD memory */
+	if (y < 0 || y >= lcd_orientation.height || x1 < 0 || x0 >= lcd_orientation.width){
+		return;
+	}
+	if (x0 < 0){
+		x0 = 0;
+	}
+	Fill(x0, y, x1, y, color);
+}
+
+/**
+ * @brief  		Fills the spans of the four quadrants of a circle split apart: the top quadrants are centered
+ * 				at yt and the bottom ones at yb, the left ones at xl and the right ones at xr. Each row is
+ * 				filled once. The rows between yt and yb are not filled.
+ */
+static void CircleSpans(int16_t xl, int16_t xr, int16_t yt, int16_t yb, int16_t r, uint16_t color){
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+	int16_t px = x;
+	int16_t py = y;
+
+	while (x < y){
+		if (f >= 0){
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		/* Rows at distance x from the center are y wide, and the ones at distance y are x wide */
+		if (x < (y + 1)){
+			Span(xl - y, xr + y, yt - x, color);
+			Span(xl - y, xr + y, yb + x, color);
+		}
+		if (y != py){
+			Span(xl - px, xr + px, yt - py, color);
+			Span(xl - px, xr + px, yb + py, color);
+			py = y;
+		}
+		px = x;
+	}
+}
+
+/**
+ * @brief  		Initializes a polygon edge at its top row
+ */
+static void EdgeInit(edge_t *edge, int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	int16_t dx, dy;
+	if (y0 > y1){
+		dx = x0;
+		x0 = x1;
+		x1 = dx;
+		dy = y0;
+		y0 = y1;
+		y1 = dy;
+	}
+	dx = x1 - x0;
+	dy = y1 - y0;
+	edge->x = x0;
+	edge->y_top = y0;
+	edge->y_bottom = y1;
+	edge->sign = (dx < 0) ? -1 : 1;
+	if (dy){
+		edge->step = dx / dy;
+		edge->rem = (dx < 0) ? (-dx % dy) : (dx % dy);
+	}
+	else{
+		edge->step = 0;
+		edge->rem = 0;
+	}
+	/* Start half way so x is rounded to the nearest pixel */
+	edge->err = dy / 2;
+}
+
+/**
+ * @brief  		Moves an edge to the next row
+ */
+static void EdgeStep(edge_t *edge){
+	int16_t dy = edge->y_bottom - edge->y_top;
+	edge->x += edge->step;
+	edge->err += edge->rem;
+	if (dy && edge->err >= dy){
+		edge->x += edge->sign;
+		edge->err -= dy;
+	}
+}
+
+static void PixelStreamFlush(void){
+	/* Send the full buffer while the next one is being filled */
+	SpiWriteQueued(ili9341_spi, stream_buf[stream_idx], stream_len);
+	stream_idx ^= 1;
+	stream_len = 0;
+}
+
+static void PixelStreamBegin(void){
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 	WriteLCD(&lcd_write);
+	/* Data from now on */
+	GPIOOn(ili9341_dc);
+	stream_len = 0;
+}
+
+static void PixelStreamPut(uint16_t color){
+	stream_buf[stream_idx][stream_len++] = HighByte(color);
+	stream_buf[stream_idx][stream_len++] = LowByte(color);
+	if (stream_len == BURST_SIZE){
+		PixelStreamFlush();
+	}
+}
+
+static void PixelStreamCopy(const uint8_t *data, uint32_t bytes_count){
+	uint32_t n;
+	uint8_t *dst;
+	while (bytes_count){
+		n = BURST_SIZE - stream_len;
+		if (n > bytes_count){
+			n = bytes_count;
+		}
+		dst = &stream_buf[stream_idx][stream_len];
+		for (uint32_t i = 0; i < n; i++){
+			dst[i] = data[i];
+		}
+		stream_len += n;
+		data += n;
+		bytes_count -= n;
+		if (stream_len == BURST_SIZE){
+			PixelStreamFlush();
+		}
+	}
+}
 
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+static void PixelStreamEnd(void){
+	if (stream_len){
+		PixelStreamFlush();
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	SpiWaitQueued(ili9341_spi);
+}
+
+/**
+ * @brief  		Streams one row of a 1 bit per pixel bitmap
+ */
+static void BitmapRowStream(const uint8_t *row, uint16_t width, uint16_t foreground, uint16_t background){
+	for (uint16_t j = 0; j < width; j++){
+		PixelStreamPut((row[j >> 3] & (MSK_BIT8 >> (j & 7))) ? foreground : background);
+	}
+}
+
+/**
+ * @brief  		Colors of a glyph being decoded, and where to write it (GlyphExpand())
+ */
+typedef struct{
+	uint16_t color[2];		/*!< Background and foreground */
+	uint8_t *dst;			/*!< Next pixel (RGB565, 2 bytes/pixel) */
+} glyph_dst_t;
+
+static void GlyphStreamRun(void *param, uint8_t pixel, uint16_t run){
+	uint16_t color = ((glyph_dst_t *)param)->color[pixel];
+	while (run--){
+		PixelStreamPut(color);
+	}
+}
+
+/**
+ * @brief  		Streams a whole glyph, decoding it from the font data
+ */
+static void GlyphStream(Font_t *font, char data, uint16_t foreground, uint16_t background){
+	glyph_dst_t glyph = {.color = {background, foreground}};
+	ILI9341GlyphDecode(data, font, GlyphStreamRun, &glyph);
+}
+
+static void GlyphExpandRun(void *param, uint8_t pixel, uint16_t run){
+	glyph_dst_t *glyph = param;
+	uint16_t color = glyph->color[pixel];
+	while (run--){
+		*glyph->dst++ = HighByte(color);
+		*glyph->dst++ = LowByte(color);
+	}
+}
+
+/**
+ * @brief  		Expands a glyph to RGB565 (2 bytes/pixel, high byte first)
+ */
+static void GlyphExpand(Font_t *font, char data, uint16_t foreground, uint16_t background, uint8_t *dst){
+	glyph_dst_t glyph = {.color = {background, foreground}, .dst = dst};
+	ILI9341GlyphDecode(data, font, GlyphExpandRun, &glyph);
+}
+
+/**
+ * @brief  		Removes a glyph from cache, compacting the arena
+ */
+static void GlyphCacheEvict(uint8_t index){
+	uint32_t size = glyph_cache[index].size;
+
+	for (uint32_t i = glyph_cache[index].offset; i + size < glyph_used; i++){
+		glyph_arena[i] = glyph_arena[i + size];
+	}
+	glyph_used -= size;
+	glyph_count--;
+	for (uint8_t i = index; i < glyph_count; i++){
+		glyph_cache[i] = glyph_cache[i + 1];
+		glyph_cache[i].offset -= size;
+	}
+}
+
+static const uint8_t * GlyphCacheFind(Font_t *font, char data, uint16_t foreground, uint16_t background){
+	glyph_entry_t *entry;
+
+	for (uint8_t i = 0; i < glyph_count; i++){
+		entry = &glyph_cache[i];
+		if ((entry->font == font) && (entry->data == data) && 
+			(entry->foreground == foreground) && (entry->background == background)){
+			entry->stamp = glyph_op;
+			return &glyph_arena[entry->offset];
+		}
+	}
+	return NULL;
+}
+
+static const uint8_t * GlyphCacheGet(Font_t *font, char data, uint16_t foreground, uint16_t background){
+	uint32_t size = (uint32_t)font->info[data - ' '].width * font->font_height * 2;
+	uint8_t lru;
+	glyph_entry_t *entry;
+	const uint8_t *glyph;
+
+	glyph = GlyphCacheFind(font, data, foreground, background);
+	if (glyph != NULL){
+		return glyph;
+	}
+	if (size > ILI9341_GLYPH_CACHE_SIZE){
+		return NULL;
+	}
+	/* Evict least recently used glyphs until the new one fits */
+	while ((glyph_used + size > ILI9341_GLYPH_CACHE_SIZE) || (glyph_count == ILI9341_GLYPH_CACHE_ENTRIES)){
+		lru = glyph_count;
+		for (uint8_t i = 0; i < glyph_count; i++){
+			if ((glyph_cache[i].stamp != glyph_op) && 
+				((lru == glyph_count) || (glyph_cache[i].stamp < glyph_cache[lru].stamp))){
+				lru = i;
+			}
+		}
+		if (lru == glyph_count){
+			/* Every glyph in cache is in use */
+			return NULL;
+		}
+		GlyphCacheEvict(lru);
+	}
+	entry = &glyph_cache[glyph_count++];
+	entry->font = font;
+	entry->data = data;
+	entry->foreground = foreground;
+	entry->background = background;
+	entry->offset = glyph_used;
+	entry->size = size;
+	entry->stamp = glyph_op;
+	glyph_used += size;
+	GlyphExpand(font, data, foreground, background, &glyph_arena[entry->offset]);
+	return &glyph_arena[entry->offset];
 }
 
 /*==================[external functions definition]==========================*/
@@ -311,7 +695,7 @@ void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color){
 }
 
 void ILI9341Fill(uint16_t color){
-	Fill(0, 0, lcd_orientation.width, lcd_orientation.height, color);
+	Fill(0, 0, lcd_orientation.width - 1, lcd_orientation.height - 1, color);
 }
 
 void ILI9341Rotate(ili9341_orientation_t orientation){
@@ -349,74 +733,53 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 	WriteLCD(&lcd_mem_acc);
 }
 
+ili9341_orientation_t ILI9341GetOrientation(void){
+	return lcd_orientation.orientation;
+}
+
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
-	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	static uint16_t lcd_x, lcd_y, width;
+	const uint8_t *glyph;
+	uint32_t bytes_count, n;
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
+	width = font->info[data - ' '].width;
 
 	/* If at the end of a line of display, go to new line and set x to 0 position */
-	if ((lcd_x + font->info[data - ' '].width) > lcd_orientation.width)	{
+	if ((lcd_x + width) > lcd_orientation.width)	{
 		lcd_y += font->font_height;
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
+	SetCursorPosition(lcd_x, lcd_y, lcd_x + width - 1, lcd_y + font->font_height - 1);
+
+	glyph_op++;
+	glyph = GlyphCacheGet(font, data, foreground, background);
+	if (glyph != NULL){
+		/* Send the cached glyph straight from the cache arena */
+		lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+		WriteLCD(&lcd_write);
+		bytes_count = (uint32_t)width * font->font_height * 2;
+		while (bytes_count){
+			n = (bytes_count > SPI_MAX_TRANSFER) ? SPI_MAX_TRANSFER : bytes_count;
+			lcd_cmd_t lcd_pixels = {NULL, n, (uint8_t *)glyph};
+			WriteLCD(&lcd_pixels);
+			glyph += n;
+			bytes_count -= n;
 		}
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	else{
+		PixelStreamBegin();
+		GlyphStream(font, data, foreground, background);
+		PixelStreamEnd();
+	}
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	const uint8_t *row;
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -430,47 +793,14 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 
 	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
+	/* Draw icon data, row by row */
+	PixelStreamBegin();
+	row = &icon_font->data[(uint32_t)icon * icon_font->offset];
+	for (uint16_t i = 0; i < icon_font->height; i++){
+		BitmapRowStream(row, icon_font->width, foreground, background);
+		row += (icon_font->width + 7) / 8;
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	PixelStreamEnd();
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
@@ -488,9 +818,70 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
 	}
 }
 
+/**
+ * @brief  		Draws a single line string in one burst, row by row
+ * @retval 		true if the string was drawn, false if it must be drawn character by character
+ */
+static bool DrawStringBurst(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
+	static const uint8_t *glyphs[STRING_MAX_CHARS];
+	uint16_t len = 0, width = 0, w;
+	const uint8_t *row;
+
+	for (char *c = str; *c != '\0'; c++){
+		if ((*c == '\n') || (*c == '\r') || (len == STRING_MAX_CHARS)){
+			return false;
+		}
+		width += font->info[*c - ' '].width + 1;
+		len++;
+	}
+	if (len == 0){
+		return true;
+	}
+	width--;	/* No gap after the last character */
+	if ((x + width) > lcd_orientation.width){
+		return false;
+	}
+	/* Get all the glyphs before drawing: the ones used here can't be evicted */
+	glyph_op++;
+	for (uint16_t k = 0; k < len; k++){
+		if ((GlyphCacheGet(font, str[k], foreground, background) == NULL) && (font->format == FONT_RLE)){
+			/* RLE glyphs can't be decoded row by row */
+			return false;
+		}
+	}
+	/* Evictions compact the arena and move the glyphs got before, so pointers are taken afterwards */
+	for (uint16_t k = 0; k < len; k++){
+		glyphs[k] = GlyphCacheFind(font, str[k], foreground, background);
+	}
+
+	SetCursorPosition(x, y, x + width - 1, y + font->font_height - 1);
+	PixelStreamBegin();
+	for (uint16_t i = 0; i < font->font_height; i++){
+		for (uint16_t k = 0; k < len; k++){
+			w = font->info[str[k] - ' '].width;
+			if (glyphs[k] != NULL){
+				PixelStreamCopy(&glyphs[k][(uint32_t)i * w * 2], w * 2);
+			}
+			else{
+				row = &font->data[font->info[str[k] - ' '].offset + i * ((w + 7) / 8)];
+				BitmapRowStream(row, w, foreground, background);
+			}
+			if (k < len - 1){
+				PixelStreamPut(background);
+			}
+		}
+	}
+	PixelStreamEnd();
+	return true;
+}
+
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
 	static uint16_t lcd_x, lcd_y;
 
+	if (DrawStringBurst(x, y, str, font, foreground, background)){
+		return;
+	}
+
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
@@ -521,6 +912,51 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 	}
 }
 
+void ILI9341GlyphCacheClear(void){
+	glyph_count = 0;
+	glyph_used = 0;
+}
+
+void ILI9341GlyphDecode(char data, Font_t *font, void (*func_p)(void *param, uint8_t pixel, uint16_t run), void *param_p){
+	const char_info_t *info = &font->info[data - ' '];
+	const uint8_t *src = &font->data[info->offset];
+	uint32_t pixels, run;
+	uint8_t pixel;
+
+	if (font->format == FONT_RLE){
+		pixels = (uint32_t)info->width * font->font_height;
+		while (pixels){
+			run = (*src & FONT_RLE_LEN_MSK) + 1;
+			if (run > pixels){
+				run = pixels;
+			}
+			pixels -= run;
+			func_p(param_p, (*src & FONT_RLE_PIXEL_MSK) ? 1 : 0, run);
+			src++;
+		}
+	}
+	else{
+		/* Equal pixels of a row are merged in a single run */
+		for (uint16_t i = 0; i < font->font_height; i++){
+			run = 0;
+			pixel = 0;
+			for (uint16_t j = 0; j < info->width; j++){
+				uint8_t bit = (src[j >> 3] & (MSK_BIT8 >> (j & 7))) ? 1 : 0;
+				if (run && (bit != pixel)){
+					func_p(param_p, pixel, run);
+					run = 0;
+				}
+				pixel = bit;
+				run++;
+			}
+			if (run){
+				func_p(param_p, pixel, run);
+			}
+			src += (info->width + 7) / 8;
+		}
+	}
+}
+
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height){
 	static uint16_t w;
 
@@ -647,36 +1083,8 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
-
-	f = 1 - r;
-	ddF_x = 1;
-	ddF_y = -2 * r;
-	x = 0;
-	y = r;
-
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
-
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
-    }
+	Span(x0 - r, x0 + r, y0, color);
+	CircleSpans(x0, x0, y0, y0, r, color);
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -686,148 +1094,255 @@ void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
 }
 
 void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
-	static int16_t x_0 = 0;
-	static int16_t y_0 = 0;
-	static int16_t x_1 = 0;
-	static int16_t y_1 = 0;
-	static int16_t x_2 = 0;
-	static int16_t y_2 = 0;
-	static int16_t x_aux = 0;
-	static int16_t y_aux = 0;
-	static int16_t scanline_y = 0;
-	float invslope1, invslope2, curx1, curx2;
-	if((y0 <= y1) && (y0 <= y2)){
-		x_0 = x0;
-		y_0 = y0;
-		if(y1 <= y2){
-			x_1 = x1;
-			y_1 = y1;
-			x_2 = x2;
-			y_2 = y2;
-		} else{
-			x_1 = x2;
-			y_1 = y2;
-			x_2 = x1;
-			y_2 = y1;
-		}
-	}else if((y1 <= y2) && (y1 <= y0)){
-		x_0 = x1;
-		y_0 = y1;
-		if(y0 <= y2){
-			x_1 = x0;
-			y_1 = y0;
-			x_2 = x2;
-			y_2 = y2;
-		} else{
-			x_1 = x2;
-			y_1 = y2;
-			x_2 = x0;
-			y_2 = y0;
-		}
-	}else if((y2 <= y1) && (y2 <= y0)){
-		x_0 = x2;
-		y_0 = y2;
-		if(y0 <= y1){
-			x_1 = x0;
-			y_1 = y0;
-			x_2 = x1;
-			y_2 = y1;
-		} else{
-			x_1 = x1;
-			y_1 = y1;
-			x_2 = x0;
-			y_2 = y0;
-		}
+	int16_t aux, y;
+	edge_t long_edge, short_edge;
+
+	/* Sort vertices by y (y0 <= y1 <= y2) */
+	if (y0 > y1){
+		aux = x0; x0 = x1; x1 = aux;
+		aux = y0; y0 = y1; y1 = aux;
+	}
+	if (y1 > y2){
+		aux = x1; x1 = x2; x2 = aux;
+		aux = y1; y1 = y2; y2 = aux;
+	}
+	if (y0 > y1){
+		aux = x0; x0 = x1; x1 = aux;
+		aux = y0; y0 = y1; y1 = aux;
+	}
+	/* All vertices in the same row */
+	if (y0 == y2){
+		int16_t x_min = x0, x_max = x0;
+		if (x1 < x_min) x_min = x1;
+		if (x2 < x_min) x_min = x2;
+		if (x1 > x_max) x_max = x1;
+		if (x2 > x_max) x_max = x2;
+		Span(x_min, x_max, y0, color);
+		return;
+	}
+	/* Each row is a span between the long edge (0-2) and one of the short ones (0-1, then 1-2) */
+	EdgeInit(&long_edge, x0, y0, x2, y2);
+	if (y1 > y0){
+		EdgeInit(&short_edge, x0, y0, x1, y1);
+	}
+	else{
+		EdgeInit(&short_edge, x1, y1, x2, y2);
 	}
-	if(y_1 == y_2){
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
+	for (y = y0; y <= y2; y++){
+		if (y == y1 && y1 > y0){
+			EdgeInit(&short_edge, x1, y1, x2, y2);
 		}
-  	}
-  	else if (y_0 == y_1){
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		invslope2 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
+		Span(long_edge.x, short_edge.x, y, color);
+		EdgeStep(&long_edge);
+		EdgeStep(&short_edge);
+	}
+}
+
+void ILI9341DrawFilledRoundRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, uint16_t color){
+	int16_t aux;
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* The radius can't exceed half of the shorter side */
+	if (2 * r > x1 - x0){
+		r = (x1 - x0) / 2;
+	}
+	if (2 * r > y1 - y0){
+		r = (y1 - y0) / 2;
+	}
+	if (r < 0){
+		r = 0;
+	}
+	/* Middle band in a single window, corners as spans */
+	if (y1 - r >= 0 && x1 >= 0){
+		Fill((x0 < 0) ? 0 : x0, (y0 + r < 0) ? 0 : y0 + r, x1, y1 - r, color);
+	}
+	CircleSpans(x0 + r, x1 - r, y0 + r, y1 - r, r, color);
+}
+
+void ILI9341DrawFilledPolygon(const int16_t *x, const int16_t *y, uint8_t n, uint16_t color){
+	edge_t edges[POLY_MAX_VERTICES];
+	int16_t xs[POLY_MAX_VERTICES];
+	uint8_t n_edges = 0;
+	uint8_t n_xs, i, j;
+	int16_t y_min, y_max, row, aux;
+
+	if (n < 3 || n > POLY_MAX_VERTICES){
+		return;
+	}
+	y_min = y[0];
+	y_max = y[0];
+	for (i = 0; i < n; i++){
+		j = (i + 1) % n;
+		if (y[i] < y_min) y_min = y[i];
+		if (y[i] > y_max) y_max = y[i];
+		/* Horizontal edges are covered by the spans of their neighbours */
+		if (y[i] != y[j]){
+			EdgeInit(&edges[n_edges++], x[i], y[i], x[j], y[j]);
 		}
-  	}
-  	else{
-		// Split in a flat top triangle and a bottom flat triangle
-		x_aux = (int)(x_0 + (float)(y_1 - y_0) / (float)(y_2 - y_0) * (x_2 - x_0));
-		y_aux = y_1;
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_aux - x_0) / (float)(y_aux - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
+	}
+	for (row = y_min; row <= y_max; row++){
+		/* Crossings of the row: edges cover [y_top, y_bottom), but the last row is included */
+		n_xs = 0;
+		for (i = 0; i < n_edges; i++){
+			if (row >= edges[i].y_top && (row < edges[i].y_bottom || (row == edges[i].y_bottom && row == y_max))){
+				/* Insertion sort */
+				for (j = n_xs; j > 0 && xs[j - 1] > edges[i].x; j--){
+					xs[j] = xs[j - 1];
+				}
+				xs[j] = edges[i].x;
+				n_xs++;
+			}
+			if (row >= edges[i].y_top && row < edges[i].y_bottom){
+				EdgeStep(&edges[i]);
+			}
 		}
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		invslope2 = (float)(x_2 - x_aux) / (float)(y_2 - y_aux);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
+		/* Even-odd rule */
+		for (i = 0; i + 1 < n_xs; i += 2){
+			aux = xs[i + 1];
+			Span(xs[i], aux, row, color);
 		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
-  	}
+	}
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
 	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = width * height * 2;
+	/* 2 bytes/pixel, copied from flash while the previous burst is being sent */
+	PixelStreamBegin();
+	PixelStreamCopy(pic, (uint32_t)width * height * 2);
+	PixelStreamEnd();
+}
 
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+void ILI9341DrawCompressedPicture(uint16_t x, uint16_t y, const ili9341_picture_t* pic){
+	const uint8_t *src = pic->data;
+	uint32_t pixels = (uint32_t)pic->width * pic->height;
+	uint32_t count;
+	uint16_t color;
+
+	SetCursorPosition(x, y, x + pic->width - 1, y + pic->height - 1);
+	PixelStreamBegin();
+	while (pixels){
+		count = (*src & PIC_RUN_MSK) + 1;
+		if (count > pixels){
+			count = pixels;
+		}
+		pixels -= count;
+		if (*src++ & PIC_RUN_FLAG){
+			/* Run: same palette index repeated */
+			color = pic->palette[*src++];
+			while (count--){
+				PixelStreamPut(color);
+			}
+		}
+		else{
+			/* Literal: a palette index for each pixel */
+			while (count--){
+				PixelStreamPut(pic->palette[*src++]);
+			}
+		}
+	}
+	PixelStreamEnd();
+}
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+void ILI9341DrawIndexed(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t bpp,
+		const uint8_t *data, uint16_t stride, const uint16_t *palette){
+	static uint8_t wire[256][2];	/*!< Palette already split in the bytes sent to the LCD */
+	uint16_t n_colors = 1 << bpp;
+	uint8_t per_byte = 8 / bpp;
+	uint8_t msk = n_colors - 1;
+	const uint8_t *src;
+	uint8_t *dst, byte, shift;
+	uint16_t j, k;
+
+	for (j = 0; j < n_colors; j++){
+		wire[j][0] = HighByte(palette[j]);
+		wire[j][1] = LowByte(palette[j]);
+	}
+	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	PixelStreamBegin();
+	for (uint16_t i = 0; i < height; i++){
+		src = data;
+		/* Each byte gives per_byte pixels, the first one in the most significant bits */
+		for (j = 0; j < width; src++){
+			byte = *src;
+			shift = 8 - bpp;
+			for (k = 0; (k < per_byte) && (j < width); k++, j++){
+				dst = &stream_buf[stream_idx][stream_len];
+				dst[0] = wire[(byte >> shift) & msk][0];
+				dst[1] = wire[(byte >> shift) & msk][1];
+				shift -= bpp;
+				stream_len += 2;
+				if (stream_len == BURST_SIZE){
+					PixelStreamFlush();
+				}
+			}
 		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
+		data += stride;
+	}
+	PixelStreamEnd();
+}
+
+void ILI9341ScrollInit(uint16_t start, uint16_t length){
+	/* Frame memory lines follow the screen y axis in portrait and the x axis in landscape (MV = 1).
+	 * Orientations with Row Address Order (MY) = 1 run in the opposite direction. */
+	scroll_flip = (lcd_orientation.orientation == ILI9341_Portrait_2) || 
+				  (lcd_orientation.orientation == ILI9341_Landscape_2);
+	scroll_top = scroll_flip ? (ILI9341_HEIGHT - start - length) : start;
+	scroll_len = length;
+	scroll_start = scroll_top;
+
+	uint16_t bottom = ILI9341_HEIGHT - scroll_top - scroll_len;
+	uint8_t area[] = {HighByte(scroll_top), LowByte(scroll_top), HighByte(scroll_len), LowByte(scroll_len),
+		HighByte(bottom), LowByte(bottom)};
+	lcd_cmd_t lcd_area = {V_SCROLL_DEF, sizeof(area), area};
+	WriteLCD(&lcd_area);
+	uint8_t line[] = {HighByte(scroll_start), LowByte(scroll_start)};
+	lcd_cmd_t lcd_start = {V_SCROLL_START, sizeof(line), line};
+	WriteLCD(&lcd_start);
+}
+
+void ILI9341ScrollPushLine(uint16_t from, uint16_t to, const uint8_t *pixels){
+	uint16_t line, pos;
+
+	if (scroll_flip){
+		/* The line shown at the screen end is the one before the first one */
+		scroll_start = scroll_top + (scroll_start - scroll_top + scroll_len - 1) % scroll_len;
+		line = scroll_start;
+	}
+	else{
+		/* The first line is the oldest one: overwrite it and show it at the end */
+		line = scroll_start;
+		scroll_start = scroll_top + (scroll_start - scroll_top + 1) % scroll_len;
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	pos = scroll_flip ? (ILI9341_HEIGHT - 1 - line) : line;
+	if (lcd_orientation.orientation >= ILI9341_Landscape_1){
+		SetCursorPosition(pos, from, pos, to);
+	}
+	else{
+		SetCursorPosition(from, pos, to, pos);
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	lcd_cmd_t lcd_pixels = {MEM_WRITE, ((uint32_t)to - from + 1) * 2, (uint8_t *)pixels};
+	WriteLCD(&lcd_pixels);
+
+	uint8_t start[] = {HighByte(scroll_start), LowByte(scroll_start)};
+	lcd_cmd_t lcd_start = {V_SCROLL_START, sizeof(start), start};
+	WriteLCD(&lcd_start);
+}
+
+void ILI9341ScrollDeInit(void){
+	uint8_t start[] = {0, 0};
+	lcd_cmd_t lcd_start = {V_SCROLL_START, sizeof(start), start};
+	WriteLCD(&lcd_start);
+	lcd_cmd_t lcd_normal = {NORMAL_MODE_ON, NULL, NULL};
+	WriteLCD(&lcd_normal);
 }
 
 uint8_t ILI9341DeInit(void){
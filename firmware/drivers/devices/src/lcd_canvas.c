@@ -0,0 +1,389 @@
+/**
+ * @file lcd_canvas.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Off-screen canvases with indexed colors for the ILI9341 color LCD
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "lcd_canvas.h"
+#include <string.h>
+#include "ili9341.h"
+/*==================[macros and definitions]=================================*/
+#define MSK_BIT8		0x80	/*!< 8th bit mask */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief		Adds an area to the area to send on the next flush (clipped to the canvas)
+ */
+static void CanvasMark(canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (y0 < 0){
+		y0 = 0;
+	}
+	if (x1 >= canvas->width){
+		x1 = canvas->width - 1;
+	}
+	if (y1 >= canvas->height){
+		y1 = canvas->height - 1;
+	}
+	if ((x0 > x1) || (y0 > y1)){
+		return;
+	}
+	if (x0 < canvas->dirty_x0){
+		canvas->dirty_x0 = x0;
+	}
+	if (y0 < canvas->dirty_y0){
+		canvas->dirty_y0 = y0;
+	}
+	if (x1 > canvas->dirty_x1){
+		canvas->dirty_x1 = x1;
+	}
+	if (y1 > canvas->dirty_y1){
+		canvas->dirty_y1 = y1;
+	}
+}
+
+/**
+ * @brief		Writes a pixel inside the canvas (no clipping)
+ */
+static inline void CanvasPut(canvas_t *canvas, int16_t x, int16_t y, uint8_t color){
+	uint32_t bit = (uint32_t)x * canvas->bpp;
+	uint8_t *p = &canvas->data[(uint32_t)y * canvas->stride + (bit >> 3)];
+	uint8_t shift = 8 - canvas->bpp - (bit & 7);
+	uint8_t msk = ((1 << canvas->bpp) - 1) << shift;
+	*p = (*p & ~msk) | ((color << shift) & msk);
+}
+
+/**
+ * @brief		Writes a pixel if it is inside the canvas
+ */
+static inline void CanvasPutClip(canvas_t *canvas, int16_t x, int16_t y, uint8_t color){
+	if ((x >= 0) && (y >= 0) && (x < canvas->width) && (y < canvas->height)){
+		CanvasPut(canvas, x, y, color);
+	}
+}
+
+/**
+ * @brief		Byte with all its pixels set to a color
+ */
+static uint8_t CanvasPattern(canvas_t *canvas, uint8_t color){
+	switch (canvas->bpp){
+	case 1:
+		return (color & 0x01) ? 0xFF : 0x00;
+	case 2:
+		return (color & 0x03) * 0x55;
+	case 4:
+		return (color & 0x0F) * 0x11;
+	default:
+		return color;
+	}
+}
+
+/**
+ * @brief		Fills a horizontal span: pixels up to the first byte boundary, whole bytes,
+ * 				and the pixels left
+ */
+static void CanvasSpan(canvas_t *canvas, int16_t x0, int16_t x1, int16_t y, uint8_t color){
+	uint8_t per_byte = 8 / canvas->bpp;
+	int16_t aux;
+
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if ((y < 0) || (y >= canvas->height) || (x1 < 0) || (x0 >= canvas->width)){
+		return;
+	}
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (x1 >= canvas->width){
+		x1 = canvas->width - 1;
+	}
+	while ((x0 <= x1) && (x0 % per_byte)){
+		CanvasPut(canvas, x0++, y, color);
+	}
+	if (x1 - x0 + 1 >= per_byte){
+		aux = (x1 - x0 + 1) / per_byte;
+		memset(&canvas->data[(uint32_t)y * canvas->stride + x0 / per_byte], CanvasPattern(canvas, color), aux);
+		x0 += aux * per_byte;
+	}
+	while (x0 <= x1){
+		CanvasPut(canvas, x0++, y, color);
+	}
+}
+
+/**
+ * @brief		Draws a row of a 1 bit per pixel bitmap
+ */
+static void CanvasBitmapRow(canvas_t *canvas, int16_t x, int16_t y, const uint8_t *row, uint16_t width,
+		uint8_t foreground, int16_t background){
+	for (uint16_t j = 0; j < width; j++){
+		if (row[j >> 3] & (MSK_BIT8 >> (j & 7))){
+			CanvasPutClip(canvas, x + j, y, foreground);
+		}
+		else if (background >= 0){
+			CanvasPutClip(canvas, x + j, y, background);
+		}
+	}
+}
+
+/**
+ * @brief		Character being drawn (CanvasDrawChar())
+ */
+typedef struct{
+	canvas_t *canvas;
+	int16_t x, y;			/*!< Top left corner */
+	uint16_t width;			/*!< Character width */
+	uint16_t col, row;		/*!< Next pixel */
+	int16_t color[2];		/*!< Background (-1: unchanged) and foreground */
+} canvas_glyph_t;
+
+static void CanvasGlyphRun(void *param, uint8_t pixel, uint16_t run){
+	canvas_glyph_t *glyph = param;
+	int16_t color = glyph->color[pixel];
+
+	while (run--){
+		if (color >= 0){
+			CanvasPutClip(glyph->canvas, glyph->x + glyph->col, glyph->y + glyph->row, color);
+		}
+		if (++glyph->col == glyph->width){
+			glyph->col = 0;
+			glyph->row++;
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+void CanvasInit(canvas_t *canvas, uint8_t color){
+	canvas->stride = ((uint32_t)canvas->width * canvas->bpp + 7) / 8;
+	CanvasFill(canvas, color);
+}
+
+uint8_t CanvasColor(canvas_t *canvas, uint16_t rgb){
+	for (uint16_t i = 0; i < (1 << canvas->bpp); i++){
+		if (canvas->palette[i] == rgb){
+			return i;
+		}
+	}
+	return 0;
+}
+
+void CanvasFill(canvas_t *canvas, uint8_t color){
+	memset(canvas->data, CanvasPattern(canvas, color), (uint32_t)canvas->stride * canvas->height);
+	CanvasInvalidate(canvas);
+}
+
+void CanvasDrawPixel(canvas_t *canvas, int16_t x, int16_t y, uint8_t color){
+	CanvasPutClip(canvas, x, y, color);
+	CanvasMark(canvas, x, y, x, y);
+}
+
+uint8_t CanvasGetPixel(canvas_t *canvas, int16_t x, int16_t y){
+	uint32_t bit;
+
+	if ((x < 0) || (y < 0) || (x >= canvas->width) || (y >= canvas->height)){
+		return 0;
+	}
+	bit = (uint32_t)x * canvas->bpp;
+	return (canvas->data[(uint32_t)y * canvas->stride + (bit >> 3)] >> (8 - canvas->bpp - (bit & 7)))
+			& ((1 << canvas->bpp) - 1);
+}
+
+void CanvasDrawLine(canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color){
+	int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+	int16_t dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);
+	int16_t sx = (x0 < x1) ? 1 : -1;
+	int16_t sy = (y0 < y1) ? 1 : -1;
+	int16_t err = dx + dy, err2;
+
+	CanvasMark(canvas, (x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0);
+	if (dy == 0){
+		CanvasSpan(canvas, x0, x1, y0, color);
+		return;
+	}
+	while (true){
+		CanvasPutClip(canvas, x0, y0, color);
+		if ((x0 == x1) && (y0 == y1)){
+			break;
+		}
+		err2 = 2 * err;
+		if (err2 >= dy){
+			err += dy;
+			x0 += sx;
+		}
+		if (err2 <= dx){
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+void CanvasDrawRectangle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color){
+	CanvasDrawLine(canvas, x0, y0, x1, y0, color);
+	CanvasDrawLine(canvas, x0, y1, x1, y1, color);
+	CanvasDrawLine(canvas, x0, y0, x0, y1, color);
+	CanvasDrawLine(canvas, x1, y0, x1, y1, color);
+}
+
+void CanvasDrawFilledRectangle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color){
+	int16_t aux;
+
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	for (int16_t y = y0; y <= y1; y++){
+		CanvasSpan(canvas, x0, x1, y, color);
+	}
+	CanvasMark(canvas, x0, y0, x1, y1);
+}
+
+void CanvasDrawCircle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t r, uint8_t color){
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+
+	CanvasPutClip(canvas, x0, y0 + r, color);
+	CanvasPutClip(canvas, x0, y0 - r, color);
+	CanvasPutClip(canvas, x0 + r, y0, color);
+	CanvasPutClip(canvas, x0 - r, y0, color);
+	while (x < y){
+		if (f >= 0){
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		CanvasPutClip(canvas, x0 + x, y0 + y, color);
+		CanvasPutClip(canvas, x0 - x, y0 + y, color);
+		CanvasPutClip(canvas, x0 + x, y0 - y, color);
+		CanvasPutClip(canvas, x0 - x, y0 - y, color);
+		CanvasPutClip(canvas, x0 + y, y0 + x, color);
+		CanvasPutClip(canvas, x0 - y, y0 + x, color);
+		CanvasPutClip(canvas, x0 + y, y0 - x, color);
+		CanvasPutClip(canvas, x0 - y, y0 - x, color);
+	}
+	CanvasMark(canvas, x0 - r, y0 - r, x0 + r, y0 + r);
+}
+
+void CanvasDrawFilledCircle(canvas_t *canvas, int16_t x0, int16_t y0, int16_t r, uint8_t color){
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+
+	/* Rows may be filled twice: writing RAM is cheap */
+	CanvasSpan(canvas, x0 - r, x0 + r, y0, color);
+	while (x < y){
+		if (f >= 0){
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		CanvasSpan(canvas, x0 - x, x0 + x, y0 + y, color);
+		CanvasSpan(canvas, x0 - x, x0 + x, y0 - y, color);
+		CanvasSpan(canvas, x0 - y, x0 + y, y0 + x, color);
+		CanvasSpan(canvas, x0 - y, x0 + y, y0 - x, color);
+	}
+	CanvasMark(canvas, x0 - r, y0 - r, x0 + r, y0 + r);
+}
+
+uint8_t CanvasDrawChar(canvas_t *canvas, int16_t x, int16_t y, char data, Font_t *font, uint8_t foreground, int16_t background){
+	canvas_glyph_t glyph = {
+		.canvas = canvas,
+		.x = x,
+		.y = y,
+		.width = font->info[data - ' '].width,
+		.color = {background, foreground},
+	};
+
+	ILI9341GlyphDecode(data, font, CanvasGlyphRun, &glyph);
+	CanvasMark(canvas, x, y, x + glyph.width - 1, y + font->font_height - 1);
+	return glyph.width;
+}
+
+void CanvasDrawString(canvas_t *canvas, int16_t x, int16_t y, const char *str, Font_t *font, uint8_t foreground, int16_t background){
+	while (*str != '\0'){
+		x += CanvasDrawChar(canvas, x, y, *str, font, foreground, background);
+		str++;
+		/* Gap between characters */
+		if ((*str != '\0') && (background >= 0)){
+			CanvasDrawFilledRectangle(canvas, x, y, x, y + font->font_height - 1, background);
+		}
+		x++;
+	}
+}
+
+void CanvasDrawIcon(canvas_t *canvas, int16_t x, int16_t y, icon_t icon, icon_font_t *icon_font, uint8_t foreground, int16_t background){
+	const uint8_t *row = &icon_font->data[(uint32_t)icon * icon_font->offset];
+
+	for (uint16_t i = 0; i < icon_font->height; i++){
+		CanvasBitmapRow(canvas, x, y + i, row, icon_font->width, foreground, background);
+		row += (icon_font->width + 7) / 8;
+	}
+	CanvasMark(canvas, x, y, x + icon_font->width - 1, y + icon_font->height - 1);
+}
+
+void CanvasInvalidate(canvas_t *canvas){
+	canvas->dirty_x0 = 0;
+	canvas->dirty_y0 = 0;
+	canvas->dirty_x1 = canvas->width - 1;
+	canvas->dirty_y1 = canvas->height - 1;
+}
+
+void CanvasFlush(canvas_t *canvas, uint16_t x, uint16_t y){
+	uint8_t per_byte = 8 / canvas->bpp;
+	int16_t x0 = canvas->dirty_x0;
+	int16_t x1 = canvas->dirty_x1;
+
+	if ((x0 > x1) || (canvas->dirty_y0 > canvas->dirty_y1)){
+		return;
+	}
+	/* Whole bytes are sent */
+	x0 -= x0 % per_byte;
+	x1 += per_byte - 1 - (x1 % per_byte);
+	if (x1 >= canvas->width){
+		x1 = canvas->width - 1;
+	}
+	ILI9341DrawIndexed(x + x0, y + canvas->dirty_y0, x1 - x0 + 1, canvas->dirty_y1 - canvas->dirty_y0 + 1,
+			canvas->bpp, &canvas->data[(uint32_t)canvas->dirty_y0 * canvas->stride + x0 / per_byte],
+			canvas->stride, canvas->palette);
+	/* Nothing left to send */
+	canvas->dirty_x0 = INT16_MAX;
+	canvas->dirty_y0 = INT16_MAX;
+	canvas->dirty_x1 = -1;
+	canvas->dirty_y1 = -1;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,576 @@
+/**
+ * @file lcd_widgets.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Retained widgets for the ILI9341 color LCD
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "lcd_widgets.h"
+#include <string.h>
+#include "ili9341.h"
+/*==================[macros and definitions]=================================*/
+#define BAR_WIDTH_PERC		90				/*!< Bar width (% of the distance between bars) */
+#define STRIP_LINE_MAX		ILI9341_WIDTH	/*!< Longest line of a strip chart (pixels) */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static uint8_t strip_line[STRIP_LINE_MAX * 2];		/*!< Line being drawn (RGB565, high byte first) */
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief		Space taken by a string, gap after the last character included
+ */
+static uint16_t TextAdvance(const char *str, Font_t *font){
+	uint16_t w = 0;
+	while (*str != '\0'){
+		w += font->info[*str - ' '].width + 1;
+		str++;
+	}
+	return w;
+}
+
+/**
+ * @brief		Redraws a label from its first changed character
+ */
+static void LabelRender(widget_label_t *label){
+	widget_t *base = &label->base;
+	uint16_t x = base->x_pos;
+	uint16_t old_end, new_end;
+	uint8_t k = 0;
+
+	if (base->drawn){
+		/* Characters kept in place */
+		while ((label->text[k] != '\0') && (label->text[k] == label->shown[k])){
+			x += label->font->info[label->text[k] - ' '].width + 1;
+			k++;
+		}
+		old_end = x + TextAdvance(&label->shown[k], label->font);
+	}
+	else{
+		old_end = x;
+	}
+	new_end = x + TextAdvance(&label->text[k], label->font);
+	if (label->text[k] != '\0'){
+		ILI9341DrawString(x, base->y_pos, &label->text[k], label->font, label->color, base->back_color);
+	}
+	/* Tail of a longer previous text */
+	if (old_end > new_end){
+		ILI9341DrawFilledRectangle((new_end > x) ? new_end - 1 : x, base->y_pos,
+				old_end - 2, base->y_pos + label->font->font_height - 1, base->back_color);
+	}
+	strcpy(label->shown, label->text);
+}
+
+/**
+ * @brief		Characters of a numeric readout, one per slot
+ */
+static void NumberFormat(widget_number_t *num, char *str){
+	bool neg = (num->value < 0) && (num->digits > 1);	/* The sign needs a slot of its own */
+	uint32_t mag = neg ? -(int64_t)num->value : ((num->value < 0) ? 0 : num->value);
+	uint64_t limit = 1;
+	int8_t i, first;
+
+	for (i = neg ? 1 : 0; i < num->digits; i++){
+		limit *= 10;
+	}
+	if (mag > limit - 1){
+		mag = limit - 1;
+	}
+	first = num->digits - 1;
+	for (i = num->digits - 1; i >= 0; i--){
+		if ((mag != 0) || (i == num->digits - 1)){
+			str[i] = '0' + mag % 10;
+			mag /= 10;
+			first = i;
+		}
+		else{
+			str[i] = num->zero_pad ? '0' : ' ';
+		}
+	}
+	if (neg){
+		str[num->zero_pad ? 0 : first - 1] = '-';
+	}
+}
+
+/**
+ * @brief		Draws a character centered in a slot of a numeric readout, clearing only what the
+ * 				previous character left outside the new one
+ */
+static void NumberSlot(widget_number_t *num, uint8_t i, char c, char prev){
+	widget_t *base = &num->base;
+	uint16_t x = base->x_pos + i * num->slot_width;
+	uint16_t y1 = base->y_pos + num->font->font_height - 1;
+	uint8_t area = num->slot_width - 1;		/* Last column is the gap between slots */
+	uint8_t w = (c == ' ') ? 0 : num->font->info[c - ' '].width;
+	uint8_t pw = (prev == ' ') ? 0 : num->font->info[prev - ' '].width;
+	uint16_t gx = x + (area - w) / 2;
+	uint16_t pgx = x + (area - pw) / 2;
+
+	if ((pw > 0) && (pgx < gx)){
+		ILI9341DrawFilledRectangle(pgx, base->y_pos, gx - 1, y1, base->back_color);
+	}
+	if ((pw > 0) && (pgx + pw > gx + w)){
+		ILI9341DrawFilledRectangle(gx + w, base->y_pos, pgx + pw - 1, y1, base->back_color);
+	}
+	if (w > 0){
+		ILI9341DrawChar(gx, base->y_pos, c, num->font, num->color, base->back_color);
+	}
+}
+
+static void NumberRender(widget_number_t *num){
+	char str[WIDGET_NUMBER_DIGITS];
+
+	NumberFormat(num, str);
+	if (!num->base.drawn){
+		memset(num->shown, ' ', sizeof(num->shown));
+	}
+	for (uint8_t i = 0; i < num->digits; i++){
+		if (str[i] != num->shown[i]){
+			NumberSlot(num, i, str[i], num->shown[i]);
+			num->shown[i] = str[i];
+		}
+	}
+}
+
+static void IconRender(widget_icon_t *icon){
+	if (!icon->base.drawn || (icon->icon != icon->shown) || (icon->color != icon->shown_color)){
+		ILI9341DrawIcon(icon->base.x_pos, icon->base.y_pos, icon->icon, icon->icon_font,
+				icon->color, icon->base.back_color);
+		icon->shown = icon->icon;
+		icon->shown_color = icon->color;
+	}
+}
+
+/**
+ * @brief		Number of steps that fit in a bar meter
+ */
+static uint8_t BarMaxSteps(widget_bar_t *bar){
+	if (bar->height < bar->step_height){
+		return 0;
+	}
+	return (bar->height - bar->step_height) / bar->step_pitch + 1;
+}
+
+/**
+ * @brief		Bottom row of a step of a bar meter (step 0 at the bottom)
+ */
+static uint16_t BarStepBottom(widget_bar_t *bar, uint8_t step){
+	return bar->base.y_pos + bar->height - 1 - bar->step_pitch * step;
+}
+
+static uint16_t BarStepColor(widget_bar_t *bar, uint8_t step){
+	uint8_t k;
+	for (k = 0; k < WIDGET_BAR_COLORS - 1; k++){
+		if (bar->step_pitch * step < bar->height * bar->thresholds[k] / 100){
+			break;
+		}
+	}
+	return bar->colors[k];
+}
+
+/**
+ * @brief		Adds or removes the steps that changed on each bar
+ */
+static void BarRender(widget_bar_t *bar){
+	widget_t *base = &bar->base;
+	uint16_t dist = bar->width / bar->n_bars;
+	uint16_t bar_width = dist * BAR_WIDTH_PERC / 100;
+	uint16_t x0, x1, bottom;
+	uint8_t lvl, old;
+
+	if (!base->drawn){
+		ILI9341DrawFilledRectangle(base->x_pos, base->y_pos, base->x_pos + bar->width - 1,
+				base->y_pos + bar->height - 1, base->back_color);
+		memset(bar->shown, 0, sizeof(bar->shown));
+	}
+	for (uint8_t i = 0; i < bar->n_bars; i++){
+		lvl = bar->level[i];
+		old = bar->shown[i];
+		if (lvl == old){
+			continue;
+		}
+		x0 = base->x_pos + i * dist + (dist - bar_width) / 2;
+		x1 = x0 + bar_width - 1;
+		if (lvl < old){
+			/* Steps lvl to old-1 removed at once */
+			ILI9341DrawFilledRectangle(x0, BarStepBottom(bar, old - 1) - bar->step_height + 1,
+					x1, BarStepBottom(bar, lvl), base->back_color);
+		}
+		else{
+			for (uint8_t j = old; j < lvl; j++){
+				bottom = BarStepBottom(bar, j);
+				ILI9341DrawFilledRectangle(x0, bottom - bar->step_height + 1, x1, bottom,
+						BarStepColor(bar, j));
+			}
+		}
+		bar->shown[i] = lvl;
+	}
+}
+
+/**
+ * @brief		Draws columns xa to xb of the track of a progress bar, filled up to column xp
+ */
+static void ProgressSlice(widget_progress_t *prog, int16_t xa, int16_t xb, int16_t xp){
+	widget_t *base = &prog->base;
+	int16_t left = base->x_pos;
+	int16_t right = base->x_pos + prog->width - 1;
+	int16_t top = base->y_pos;
+	int16_t bottom = base->y_pos + prog->height - 1;
+
+	if (xa < left){
+		xa = left;
+	}
+	if (xb > right){
+		xb = right;
+	}
+	if (xa > xb){
+		return;
+	}
+	/* Outline */
+	ILI9341DrawFilledRectangle(xa, top, xb, top, prog->track_color);
+	ILI9341DrawFilledRectangle(xa, bottom, xb, bottom, prog->track_color);
+	if (xa == left){
+		ILI9341DrawFilledRectangle(left, top, left, bottom, prog->track_color);
+		xa++;
+	}
+	if (xb == right){
+		ILI9341DrawFilledRectangle(right, top, right, bottom, prog->track_color);
+		xb--;
+	}
+	if ((xa > xb) || (bottom - top < 2)){
+		return;
+	}
+	/* Inside: progress and empty part */
+	if (xa <= xp){
+		ILI9341DrawFilledRectangle(xa, top + 1, (xb < xp) ? xb : xp, bottom - 1, prog->color);
+	}
+	if (xb > xp){
+		ILI9341DrawFilledRectangle((xa > xp) ? xa : xp + 1, top + 1, xb, bottom - 1, base->back_color);
+	}
+}
+
+static void ProgressRender(widget_progress_t *prog){
+	widget_t *base = &prog->base;
+	int16_t r = prog->knob_radius;
+	int16_t yc = base->y_pos + prog->height / 2;
+	int16_t xp = base->x_pos + prog->pos;
+	int16_t xs = base->x_pos + prog->shown;
+
+	if (!base->drawn){
+		ProgressSlice(prog, base->x_pos, base->x_pos + prog->width - 1, xp);
+	}
+	else{
+		if (r > 0){
+			/* Previous knob erased, and the track under it restored */
+			ILI9341DrawFilledCircle(xs, yc, r, base->back_color);
+			ProgressSlice(prog, xs - r, xs + r, xp);
+		}
+		if (xp > xs){
+			ProgressSlice(prog, xs + 1, xp, xp);
+		}
+		else{
+			ProgressSlice(prog, xp + 1, xs, xp);
+		}
+	}
+	if (r > 0){
+		ILI9341DrawFilledCircle(xp, yc, r, prog->knob_color);
+	}
+	prog->shown = prog->pos;
+}
+
+/**
+ * @brief		Number of pixels of the lines of a strip chart
+ */
+static uint16_t StripLineLength(widget_strip_t *strip){
+	uint16_t len = (ILI9341GetOrientation() >= ILI9341_Landscape_1) ? strip->height : strip->width;
+	return (len > STRIP_LINE_MAX) ? STRIP_LINE_MAX : len;
+}
+
+/**
+ * @brief		Position of a data value in a line, 0 being the first pixel sent
+ */
+static int16_t StripPosition(widget_trace_t *trace, int16_t data, uint16_t len){
+	int32_t pos = ((int32_t)data * trace->y_scale) / 100 + trace->y_offset;
+	if (pos < 0){
+		pos = 0;
+	}
+	if (pos > len - 1){
+		pos = len - 1;
+	}
+	/* In landscape lines are sent from top to bottom */
+	if (ILI9341GetOrientation() >= ILI9341_Landscape_1){
+		pos = len - 1 - pos;
+	}
+	return pos;
+}
+
+/**
+ * @brief		Draws the oldest pending line of a strip chart
+ */
+static void StripLine(widget_strip_t *strip){
+	uint16_t len = StripLineLength(strip);
+	int16_t (*line)[2] = strip->lines[strip->head];
+	uint16_t i;
+
+	for (i = 0; i < len; i++){
+		strip_line[2 * i] = strip->base.back_color >> 8;
+		strip_line[2 * i + 1] = strip->base.back_color & 0xFF;
+	}
+	for (uint8_t t = 0; t < strip->n_traces; t++){
+		for (i = line[t][0]; i <= line[t][1]; i++){
+			strip_line[2 * i] = strip->traces[t].color >> 8;
+			strip_line[2 * i + 1] = strip->traces[t].color & 0xFF;
+		}
+	}
+	if (ILI9341GetOrientation() >= ILI9341_Landscape_1){
+		ILI9341ScrollPushLine(strip->base.y_pos, strip->base.y_pos + len - 1, strip_line);
+	}
+	else{
+		ILI9341ScrollPushLine(strip->base.x_pos, strip->base.x_pos + len - 1, strip_line);
+	}
+	strip->head = (strip->head + 1) % WIDGET_STRIP_LINES;
+	strip->count--;
+}
+
+static void StripRender(widget_strip_t *strip){
+	widget_t *base = &strip->base;
+
+	if (!base->drawn){
+		/* The chart starts empty: the lines scrolled out before are lost */
+		ILI9341DrawFilledRectangle(base->x_pos, base->y_pos,
+				base->x_pos + strip->width - 1, base->y_pos + strip->height - 1, base->back_color);
+		if (ILI9341GetOrientation() >= ILI9341_Landscape_1){
+			ILI9341ScrollInit(base->x_pos, strip->width);
+		}
+		else{
+			ILI9341ScrollInit(base->y_pos, strip->height);
+		}
+		/* Mark as drawn before the pending lines, as a push could draw them */
+		base->drawn = true;
+	}
+	while (strip->count > 0){
+		StripLine(strip);
+	}
+}
+
+static void WidgetInit(widget_t *widget, widget_type_t type){
+	widget->type = type;
+	widget->drawn = false;
+	widget->dirty = true;
+}
+
+/*==================[external functions definition]==========================*/
+void WidgetLabelInit(widget_label_t *label, const char *text){
+	WidgetInit(&label->base, WIDGET_LABEL);
+	label->shown[0] = '\0';
+	WidgetLabelSet(label, text);
+}
+
+void WidgetLabelSet(widget_label_t *label, const char *text){
+	if (strncmp(label->text, text, WIDGET_LABEL_LEN) != 0){
+		strncpy(label->text, text, WIDGET_LABEL_LEN);
+		label->text[WIDGET_LABEL_LEN] = '\0';
+		label->base.dirty = true;
+	}
+}
+
+void WidgetNumberInit(widget_number_t *num, int32_t value){
+	uint8_t w;
+
+	WidgetInit(&num->base, WIDGET_NUMBER);
+	if (num->digits > WIDGET_NUMBER_DIGITS){
+		num->digits = WIDGET_NUMBER_DIGITS;
+	}
+	/* Slots as wide as the widest digit, so digits never move */
+	num->slot_width = num->font->info['-' - ' '].width;
+	for (char c = '0'; c <= '9'; c++){
+		w = num->font->info[c - ' '].width;
+		if (w > num->slot_width){
+			num->slot_width = w;
+		}
+	}
+	num->slot_width++;
+	num->value = value;
+}
+
+void WidgetNumberSet(widget_number_t *num, int32_t value){
+	if (value != num->value){
+		num->value = value;
+		num->base.dirty = true;
+	}
+}
+
+void WidgetIconInit(widget_icon_t *icon){
+	WidgetInit(&icon->base, WIDGET_ICON);
+}
+
+void WidgetIconSet(widget_icon_t *icon, icon_t id, uint16_t color){
+	if ((id != icon->icon) || (color != icon->color)){
+		icon->icon = id;
+		icon->color = color;
+		icon->base.dirty = true;
+	}
+}
+
+void WidgetBarInit(widget_bar_t *bar){
+	WidgetInit(&bar->base, WIDGET_BAR);
+	if (bar->n_bars > WIDGET_BAR_MAX){
+		bar->n_bars = WIDGET_BAR_MAX;
+	}
+	memset(bar->level, 0, sizeof(bar->level));
+}
+
+void WidgetBarSet(widget_bar_t *bar, const uint8_t *values){
+	uint8_t max_steps = BarMaxSteps(bar);
+	uint8_t steps;
+
+	for (uint8_t i = 0; i < bar->n_bars; i++){
+		steps = ((uint32_t)values[i] * bar->height / 256) / bar->step_pitch;
+		if (steps > max_steps){
+			steps = max_steps;
+		}
+		if (steps != bar->level[i]){
+			bar->level[i] = steps;
+			bar->base.dirty = true;
+		}
+	}
+}
+
+void WidgetProgressInit(widget_progress_t *prog){
+	WidgetInit(&prog->base, WIDGET_PROGRESS);
+	prog->pos = 0;
+	prog->shown = 0;
+}
+
+void WidgetProgressSet(widget_progress_t *prog, uint16_t value){
+	uint16_t pos;
+
+	if (value > prog->max){
+		value = prog->max;
+	}
+	pos = (uint32_t)value * (prog->width - 1) / prog->max;
+	if (pos != prog->pos){
+		prog->pos = pos;
+		prog->base.dirty = true;
+	}
+}
+
+void WidgetStripInit(widget_strip_t *strip){
+	uint16_t len = StripLineLength(strip);
+
+	WidgetInit(&strip->base, WIDGET_STRIP);
+	if (strip->n_traces > WIDGET_STRIP_TRACES){
+		strip->n_traces = WIDGET_STRIP_TRACES;
+	}
+	for (uint8_t t = 0; t < strip->n_traces; t++){
+		widget_trace_t *trace = &strip->traces[t];
+		trace->y_prev = StripPosition(trace, 0, len);
+		trace->y_min = INT16_MAX;
+		trace->y_max = INT16_MIN;
+	}
+	strip->acc = 0;
+	strip->head = 0;
+	strip->count = 0;
+}
+
+void WidgetStripPush(widget_strip_t *strip, const int16_t *data){
+	uint16_t len = StripLineLength(strip);
+	int16_t (*line)[2];
+	int16_t pos;
+	uint8_t t;
+
+	/* Samples between lines are kept as a min/max envelope, so peaks are never lost */
+	for (t = 0; t < strip->n_traces; t++){
+		widget_trace_t *trace = &strip->traces[t];
+		pos = StripPosition(trace, data[t], len);
+		if (pos < trace->y_min){
+			trace->y_min = pos;
+		}
+		if (pos > trace->y_max){
+			trace->y_max = pos;
+		}
+	}
+	strip->acc += strip->x_scale;
+	if (strip->acc < 100){
+		return;
+	}
+	strip->acc -= 100;
+
+	if (strip->count == WIDGET_STRIP_LINES){
+		if (strip->base.drawn){
+			StripLine(strip);
+		}
+		else{
+			strip->head = (strip->head + 1) % WIDGET_STRIP_LINES;
+			strip->count--;
+		}
+	}
+	line = strip->lines[(strip->head + strip->count) % WIDGET_STRIP_LINES];
+	for (t = 0; t < strip->n_traces; t++){
+		widget_trace_t *trace = &strip->traces[t];
+		/* Vertical span joining the previous point with the new envelope */
+		line[t][0] = (trace->y_prev < trace->y_min) ? trace->y_prev : trace->y_min;
+		line[t][1] = (trace->y_prev > trace->y_max) ? trace->y_prev : trace->y_max;
+		trace->y_prev = StripPosition(trace, data[t], len);
+		trace->y_min = INT16_MAX;
+		trace->y_max = INT16_MIN;
+	}
+	strip->count++;
+	strip->base.dirty = true;
+}
+
+void WidgetInvalidate(widget_t *widget){
+	widget->drawn = false;
+	widget->dirty = true;
+}
+
+void WidgetScreenInvalidate(widget_screen_t *screen){
+	for (uint8_t i = 0; i < screen->n_widgets; i++){
+		WidgetInvalidate(screen->widgets[i]);
+	}
+}
+
+void WidgetScreenRender(widget_screen_t *screen){
+	widget_t *widget;
+
+	for (uint8_t i = 0; i < screen->n_widgets; i++){
+		widget = screen->widgets[i];
+		if (!widget->dirty){
+			continue;
+		}
+		switch (widget->type){
+		case WIDGET_LABEL:
+			LabelRender((widget_label_t *)widget);
+			break;
+		case WIDGET_NUMBER:
+			NumberRender((widget_number_t *)widget);
+			break;
+		case WIDGET_ICON:
+			IconRender((widget_icon_t *)widget);
+			break;
+		case WIDGET_BAR:
+			BarRender((widget_bar_t *)widget);
+			break;
+		case WIDGET_PROGRESS:
+			ProgressRender((widget_progress_t *)widget);
+			break;
+		case WIDGET_STRIP:
+			StripRender((widget_strip_t *)widget);
+			break;
+		}
+		widget->drawn = true;
+		widget->dirty = false;
+	}
+}
+
+/*==================[end of file]============================================*/
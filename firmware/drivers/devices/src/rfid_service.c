@@ -0,0 +1,198 @@
+/**
+ * @file rfid_service.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Card presence service for the MFRC522 RFID reader
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "rfid_service.h"
+#include "rfid_utils.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros and definitions]=================================*/
+#define RFID_TASK_STACK		4096
+#define RFID_TASK_PRIO		5
+#define RFID_SCAN_TIMEOUT	5		/*!< PICC answer timeout while scanning (ms) */
+#define RFID_CMD_TIMEOUT	25		/*!< PICC answer timeout for MIFARE commands (ms) */
+#define RFID_FIELD_SETTLE	5		/*!< Time for cards to power up after the field is switched on (ms) */
+#define RFID_MAX_SELECTS	(RFID_MAX_CARDS + 2)	/*!< Anticollision rounds per scan */
+
+/**
+ * @brief Card tracked by the service
+ */
+typedef struct{
+	Uid uid;			/*!< Card UID */
+	uint8_t missed;		/*!< Consecutive scans without answer */
+} rfid_card_t;
+
+/*==================[internal data declaration]==============================*/
+static rfid_service_config_t rfid_cfg;
+static rfid_card_t rfid_cards[RFID_MAX_CARDS];
+static uint8_t rfid_n_cards = 0;
+static portMUX_TYPE rfid_mux = portMUX_INITIALIZER_UNLOCKED;
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static bool RfidSameUid(const Uid *a, const Uid *b){
+	return (a->size == b->size) && (memcmp(a->uidByte, b->uidByte, a->size) == 0);
+}
+
+static void RfidNotify(rfid_event_t event, Uid *uid){
+	if(rfid_cfg.func_p != NULL){
+		((void (*)(rfid_event_t, Uid *, void *))rfid_cfg.func_p)(event, uid, rfid_cfg.param_p);
+	}
+}
+
+/**
+ * @brief Enumerates the cards in the field: every anticollision round selects one card and
+ * halts it, so the next REQA is only answered by the remaining ones.
+ */
+static uint8_t RfidScan(Uid *found, uint8_t max){
+	MFRC522Ptr_t mfrc = rfid_cfg.mfrc;
+	uint8_t atqa[2];
+	uint8_t atqa_size;
+	uint8_t n = 0;
+	uint8_t cmd = PICC_CMD_WUPA;	/* Wake up the cards halted in the previous scan */
+	StatusCode status;
+
+	/* In case a block operation left the previous card authenticated */
+	releaseAuth(mfrc);
+	for(uint8_t round = 0; (round < RFID_MAX_SELECTS) && (n < max); round++){
+		atqa_size = sizeof(atqa);
+		status = PICC_REQA_or_WUPA(mfrc, cmd, atqa, &atqa_size);
+		if((status != STATUS_OK) && (status != STATUS_COLLISION)){
+			break;
+		}
+		cmd = PICC_CMD_REQA;
+		memset(&found[n], 0, sizeof(Uid));
+		if(PICC_Select(mfrc, &found[n], 0) != STATUS_OK){
+			continue;
+		}
+		PICC_HaltA(mfrc);
+		n++;
+	}
+	return n;
+}
+
+/**
+ * @brief Updates the card list with a scan, reporting arrivals and departures
+ */
+static void RfidUpdate(Uid *found, uint8_t n_found){
+	uint8_t i, j;
+	bool known;
+
+	/* Departures */
+	for(i = 0; i < rfid_n_cards; ){
+		known = false;
+		for(j = 0; j < n_found; j++){
+			if(RfidSameUid(&rfid_cards[i].uid, &found[j])){
+				known = true;
+			}
+		}
+		if(known){
+			rfid_cards[i].missed = 0;
+			i++;
+		}else if(++rfid_cards[i].missed >= RFID_DEPARTURE_SCANS){
+			Uid gone = rfid_cards[i].uid;
+			portENTER_CRITICAL(&rfid_mux);
+			rfid_cards[i] = rfid_cards[--rfid_n_cards];
+			portEXIT_CRITICAL(&rfid_mux);
+			RfidNotify(RFID_CARD_LEFT, &gone);
+		}else{
+			i++;
+		}
+	}
+	/* Arrivals */
+	for(j = 0; j < n_found; j++){
+		known = false;
+		for(i = 0; i < rfid_n_cards; i++){
+			if(RfidSameUid(&rfid_cards[i].uid, &found[j])){
+				known = true;
+			}
+		}
+		if(!known && (rfid_n_cards < RFID_MAX_CARDS)){
+			portENTER_CRITICAL(&rfid_mux);
+			rfid_cards[rfid_n_cards].uid = found[j];
+			rfid_cards[rfid_n_cards].missed = 0;
+			rfid_n_cards++;
+			portEXIT_CRITICAL(&rfid_mux);
+			RfidNotify(RFID_CARD_ARRIVED, &found[j]);
+		}
+	}
+}
+
+static void RfidTask(void *param){
+	MFRC522Ptr_t mfrc = rfid_cfg.mfrc;
+	Uid found[RFID_MAX_CARDS];
+	uint8_t n_found;
+	bool field_on = true;
+
+	while(true){
+		if(rfid_n_cards == 0){
+			/* Nothing to track: field off, sleep on the reader timer */
+			if(field_on){
+				PCD_AntennaOff(mfrc);
+				field_on = false;
+			}
+			PCD_WaitTimer(mfrc, rfid_cfg.idle_period);
+			PCD_AntennaOn(mfrc);
+			field_on = true;
+			PCD_WaitTimer(mfrc, RFID_FIELD_SETTLE);
+		}else{
+			PCD_WaitTimer(mfrc, rfid_cfg.scan_period);
+		}
+		PCD_SetTimeout(mfrc, RFID_SCAN_TIMEOUT);
+		n_found = RfidScan(found, RFID_MAX_CARDS);
+		PCD_SetTimeout(mfrc, RFID_CMD_TIMEOUT);
+		if((n_found > 0) || (rfid_n_cards > 0)){
+			RfidUpdate(found, n_found);
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+void RfidServiceInit(rfid_service_config_t *config){
+	rfid_cfg = *config;
+	rfid_n_cards = 0;
+	PCD_EnableIrq(rfid_cfg.mfrc, rfid_cfg.irq);
+	xTaskCreate(RfidTask, "rfid", RFID_TASK_STACK, NULL, RFID_TASK_PRIO, NULL);
+}
+
+uint8_t RfidServiceGetCards(Uid *uids, uint8_t max){
+	uint8_t n;
+	portENTER_CRITICAL(&rfid_mux);
+	n = (rfid_n_cards < max) ? rfid_n_cards : max;
+	for(uint8_t i = 0; i < n; i++){
+		uids[i] = rfid_cards[i].uid;
+	}
+	portEXIT_CRITICAL(&rfid_mux);
+	return n;
+}
+
+bool RfidServiceSelect(Uid *uid){
+	MFRC522Ptr_t mfrc = rfid_cfg.mfrc;
+	uint8_t atqa[2];
+	uint8_t atqa_size = sizeof(atqa);
+	StatusCode status;
+
+	status = PICC_WakeupA(mfrc, atqa, &atqa_size);
+	if((status != STATUS_OK) && (status != STATUS_COLLISION)){
+		return false;
+	}
+	/* With the whole UID known, the select only matches this card */
+	mfrc->uid = *uid;
+	return PICC_Select(mfrc, &mfrc->uid, uid->size * 8) == STATUS_OK;
+}
+
+/*==================[end of file]============================================*/
@@ -5,6 +5,7 @@
 */
 #include "rfid_utils.h"
 #include "uart_mcu.h"
+#include <string.h>
 /****************************************
  * Private variables
  ****************************************/
@@ -17,20 +18,31 @@ static uint8_t size = sizeof(auxBuffer);
 // return status from MFRC522 functions
 static StatusCode status;
 
+// sector authenticated with Crypto1 (-1 if none) and the card it belongs to,
+// kept across block operations until releaseCard()
+static int authSector = -1;
+static Uid authUid;
+
 
 /****************************************
  * Private Functions
  ****************************************/
 
 /**
- * Read 16 bytes from a block inside a sector
+ * Authenticate a sector with key A, unless it is already authenticated
+ * for the current card
  * @param  mfrc522   MFRC522 ADT pointer
  * @param  sector    card sector, 0 to 15
- * @param  blockAddr card block address, 0 to 63
- * @return           0 is no error, -1 is authentication error -2 is read error
+ * @param  blockAddr card block address inside the sector, 0 to 63
+ * @return           0 is no error, -1 is authentication error
  */
-static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
-						 uint8_t blockAddr) {
+static int authenticateSector(MFRC522Ptr_t mfrc522, uint8_t sector,
+							  uint8_t blockAddr) {
+
+	if (authSector == sector && authUid.size == mfrc522->uid.size &&
+		memcmp(authUid.uidByte, mfrc522->uid.uidByte, authUid.size) == 0) {
+		return 0;
+	}
 
 	MIFARE_Key key;
 	int i;
@@ -46,6 +58,25 @@ static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
 	if (status != STATUS_OK) {
 		UartSendString(UART_PC,"PCD_Authenticate() failed: ");
 		UartSendString(UART_PC,GetStatusCodeName(status));
+		authSector = -1;
+		return -1;
+	}
+	authSector = sector;
+	authUid = mfrc522->uid;
+	return 0;
+}
+
+/**
+ * Read 16 bytes from a block inside a sector
+ * @param  mfrc522   MFRC522 ADT pointer
+ * @param  sector    card sector, 0 to 15
+ * @param  blockAddr card block address, 0 to 63
+ * @return           0 is no error, -1 is authentication error -2 is read error
+ */
+static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
+						 uint8_t blockAddr) {
+
+	if (authenticateSector(mfrc522, sector, blockAddr) != 0) {
 		return -1;
 	}
 
@@ -54,14 +85,10 @@ static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
 	if (status != STATUS_OK) {
 		UartSendString(UART_PC,"MIFARE_Read() failed: ");
 		UartSendString(UART_PC,GetStatusCodeName(status));
+		authSector = -1;
 		return -2;
 	}
 
-	// Halt PICC
-    PICC_HaltA(mfrc522);
-    // Stop encryption on PCD
-    PCD_StopCrypto1(mfrc522);
-
 	return 0;
 }
 
@@ -75,19 +102,7 @@ static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
 static int writeCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
 						  uint8_t blockAddr) {
 
-	MIFARE_Key key;
-	int i;
-	// using FFFFFFFFFFFF which is the default at chip delivery from the factory
-	for (i = 0; i < 6; i++) {
-		key.keybyte[i] = 0xFF;
-	}
-
-	// Authenticate using key A
-	status = (StatusCode)PCD_Authenticate(mfrc522, PICC_CMD_MF_AUTH_KEY_A,
-										  blockAddr, &key, &(mfrc522->uid));
-	if (status != STATUS_OK) {
-		UartSendString(UART_PC,"PCD_Authenticate() failed: ");
-		UartSendString(UART_PC,GetStatusCodeName(status));
+	if (authenticateSector(mfrc522, sector, blockAddr) != 0) {
 		return -1;
 	}
 
@@ -96,14 +111,10 @@ static int writeCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
 	if (status != STATUS_OK) {
 		UartSendString(UART_PC,"MIFARE_Write() failed: ");
 		UartSendString(UART_PC,GetStatusCodeName(status));
+		authSector = -1;
 		return -2;
 	}
 
-	// Halt PICC
-    PICC_HaltA(mfrc522);
-    // Stop encryption on PCD
-    PCD_StopCrypto1(mfrc522);
-
 	return 0;
 }
 
@@ -132,6 +143,18 @@ void setupRFID(MFRC522Ptr_t* mfrc522) {
 	PCD_DumpVersionToSerial(*mfrc522); 
 }
 
+void releaseAuth(MFRC522Ptr_t mfrc522) {
+    // Stop encryption on PCD
+    PCD_StopCrypto1(mfrc522);
+	authSector = -1;
+}
+
+void releaseCard(MFRC522Ptr_t mfrc522) {
+	// Halt PICC
+    PICC_HaltA(mfrc522);
+	releaseAuth(mfrc522);
+}
+
 /**
  * Function to read the balance, the balance is stored in the block 4 (sector
  * 1), the first 4 bytes
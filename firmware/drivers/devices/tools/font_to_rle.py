@@ -0,0 +1,100 @@
+"""
+Converts the bitmap fonts of fonts.c to the run-length encoded format (FONT_RLE).
+
+Each byte of a glyph codes a run of pixels: bit 7 is the pixel value and bits 0-6
+the run length minus one. Glyphs are coded row by row, without padding.
+
+Usage: python font_to_rle.py fonts.c height [height ...]
+    The data and info arrays of the given fonts are replaced in place, and FONT_RLE is
+    added to their Font_t, so the fonts keep their names (e.g. font_89).
+    Fonts already run-length encoded are skipped.
+"""
+import re
+import sys
+
+RUN_MAX = 128
+
+
+def parse_fonts(source):
+    """Returns {height: (data bytes, [(width, offset), ...])} for each font in fonts.c"""
+    fonts = {}
+    for m in re.finditer(r'const uint8_t font(\d+)_data\[\] = \{(.*?)\};', source, re.S):
+        height = int(m.group(1))
+        body = re.sub(r'//.*', '', m.group(2))
+        data = [int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]+', body)]
+        info_m = re.search(r'char_info_t font%d_info\[\] = \{(.*?)\};' % height, source, re.S)
+        info = [(int(w), int(o)) for w, o in re.findall(r'\{\s*(\d+),\s*(\d+)\s*\}', info_m.group(1))]
+        if re.search(r'Font_t font_%d = \{[^}]*FONT_RLE' % height, source):
+            continue
+        fonts[height] = (data, info)
+    return fonts
+
+
+def glyph_pixels(data, height, width, offset):
+    row_bytes = (width + 7) // 8
+    for i in range(height):
+        row = data[offset + i * row_bytes: offset + (i + 1) * row_bytes]
+        for j in range(width):
+            yield 1 if row[j // 8] & (0x80 >> (j % 8)) else 0
+
+
+def rle_encode(pixels):
+    out = []
+    value, run = None, 0
+    for p in pixels:
+        if p == value and run < RUN_MAX:
+            run += 1
+        else:
+            if run:
+                out.append((value << 7) | (run - 1))
+            value, run = p, 1
+    if run:
+        out.append((value << 7) | (run - 1))
+    return out
+
+
+def convert(height, data, info):
+    rle_data = []
+    rle_info = []
+    for width, offset in info:
+        rle_info.append((width, len(rle_data)))
+        rle_data += rle_encode(glyph_pixels(data, height, width, offset))
+    if len(rle_data) > 0xFFFF:
+        raise ValueError('font %d: encoded data exceeds 16 bits offsets' % height)
+    return rle_data, rle_info
+
+
+def rewrite_c(source, fonts, heights):
+    for height in heights:
+        data, info = fonts[height]
+        rle_data, rle_info = convert(height, data, info)
+        print('font %d: %d -> %d bytes' % (height, len(data), len(rle_data)))
+        lines = ['const uint8_t font%d_data[] = {' % height]
+        for i in range(0, len(rle_data), 16):
+            lines.append('\t' + ', '.join('0x%02X' % b for b in rle_data[i:i + 16]) + ',')
+        lines.append('};')
+        source = re.sub(r'const uint8_t font%d_data\[\] = \{.*?\};' % height,
+                        lambda m: '\n'.join(lines), source, flags=re.S)
+        lines = ['char_info_t font%d_info[] = {' % height]
+        for k, (width, offset) in enumerate(rle_info):
+            lines.append('\t{%d, %d}, \t\t/* %s */ ' % (width, offset, chr(ord(' ') + k)))
+        lines.append('};')
+        source = re.sub(r'char_info_t font%d_info\[\] = \{.*?\n\};' % height,
+                        lambda m: '\n'.join(lines), source, flags=re.S)
+        source = re.sub(r'(Font_t font_%d = \{[^}]*font%d_data)\n' % (height, height),
+                        r'\1,\n\tFONT_RLE\n', source)
+        source = source.replace(' * @brief %d pixels height data array. ' % height,
+                                ' * @brief %d pixels height data array (run-length encoded). ' % height)
+    return source
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+    with open(sys.argv[1]) as f:
+        source = f.read()
+    fonts = parse_fonts(source)
+    heights = [int(h) for h in sys.argv[2:] if int(h) in fonts]
+    with open(sys.argv[1], 'w') as f:
+        f.write(rewrite_c(source, fonts, heights))
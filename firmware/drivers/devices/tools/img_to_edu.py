@@ -0,0 +1,147 @@
+"""
+Converts a picture to the compressed format drawn by ILI9341DrawCompressedPicture().
+
+Pixels are converted to RGB565, indexed to a palette (up to 256 colors) and
+run-length encoded. The data array is a sequence of packets, each one starting
+with a header byte:
+    bit 7 set:   run, the next byte is a palette index repeated (header & 0x7F) + 1 times
+    bit 7 clear: literal, (header + 1) palette indexes follow
+
+Usage (output.c writes the definitions only, to be declared extern in a header):
+    python img_to_edu.py picture.png name output.h
+        Converts an image file (requires Pillow). Images with more than 256
+        colors are quantized.
+    python img_to_edu.py --raw width height array.h name output.h
+        Converts a raw RGB565 C array (2 bytes/pixel, high byte first), as the
+        ones generated with "65K Color (2 bytes/pixel)" converters. Arrays with
+        more than 256 colors are quantized (requires Pillow).
+"""
+import re
+import sys
+
+RUN_MIN = 3         # shorter runs are coded as literals
+PACKET_MAX = 128
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def quantize(img):
+    """Reduces an RGB image to 256 colors (after RGB565 conversion) if needed"""
+    if len({rgb565(*p) for p in img.getdata()}) > 256:
+        img = img.quantize(256).convert('RGB')
+    return [rgb565(*p) for p in img.getdata()]
+
+
+def load_image(path):
+    from PIL import Image
+    img = Image.open(path).convert('RGB')
+    return img.width, img.height, quantize(img)
+
+
+def load_raw(path, width, height):
+    with open(path) as f:
+        body = f.read()
+    body = body[body.index('{') + 1:body.rindex('}')]
+    data = [int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]+', body)]
+    if len(data) < width * height * 2:
+        raise ValueError('array has %d bytes, %d expected' % (len(data), width * height * 2))
+    pixels = [(data[2 * i] << 8) | data[2 * i + 1] for i in range(width * height)]
+    if len(set(pixels)) > 256:
+        from PIL import Image
+        img = Image.new('RGB', (width, height))
+        img.putdata([((c >> 8) & 0xF8, (c >> 3) & 0xFC, (c << 3) & 0xF8) for c in pixels])
+        pixels = quantize(img)
+    return width, height, pixels
+
+
+def encode(pixels):
+    palette = sorted(set(pixels))
+    if len(palette) > 256:
+        raise ValueError('more than 256 colors')
+    index = {c: i for i, c in enumerate(palette)}
+    idx = [index[p] for p in pixels]
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:PACKET_MAX]
+            del literal[:PACKET_MAX]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(idx):
+        run = 1
+        while i + run < len(idx) and idx[i + run] == idx[i] and run < PACKET_MAX:
+            run += 1
+        if run >= RUN_MIN:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(idx[i])
+            i += run
+        else:
+            literal.append(idx[i])
+            i += 1
+    flush_literal()
+    return palette, out
+
+
+def decode(palette, data, n_pixels):
+    pixels = []
+    i = 0
+    while len(pixels) < n_pixels:
+        count = (data[i] & 0x7F) + 1
+        if data[i] & 0x80:
+            pixels += [palette[data[i + 1]]] * count
+            i += 2
+        else:
+            pixels += [palette[v] for v in data[i + 1:i + 1 + count]]
+            i += 1 + count
+    return pixels
+
+
+def write_h(name, width, height, palette, data, path):
+    guard = name.upper() + '_H_'
+    header = not path.endswith('.c')
+    lines = ['/* Generated by img_to_edu.py, do not edit */']
+    if header:
+        lines += ['#ifndef ' + guard, '#define ' + guard]
+    lines += ['#include "ili9341.h"', '',
+              'const uint16_t %s_palette[] = {' % name]
+    for i in range(0, len(palette), 8):
+        lines.append('\t' + ', '.join('0x%04X' % c for c in palette[i:i + 8]) + ',')
+    lines += ['};', '', 'const uint8_t %s_data[] = {' % name]
+    for i in range(0, len(data), 16):
+        lines.append('\t' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    lines += ['};', '',
+              'const ili9341_picture_t %s = {' % name,
+              '\t%d,' % width, '\t%d,' % height,
+              '\t%s_palette,' % name, '\t%s_data' % name,
+              '};', '']
+    if header:
+        lines += ['#endif /* %s */' % guard, '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    if len(args) == 3:
+        width, height, pixels = load_image(args[0])
+        name, out_path = args[1], args[2]
+    elif len(args) == 6 and args[0] == '--raw':
+        width, height, pixels = load_raw(args[3], int(args[1]), int(args[2]))
+        name, out_path = args[4], args[5]
+    else:
+        print(__doc__)
+        sys.exit(1)
+    palette, data = encode(pixels)
+    assert decode(palette, data, len(pixels)) == pixels
+    write_h(name, width, height, palette, data, out_path)
+    raw = width * height * 2
+    compressed = len(data) + 2 * len(palette)
+    print('%dx%d, %d colors: %d -> %d bytes (%.1fx)' % (width, height, len(palette), raw, compressed,
+                                                        raw / compressed))
@@ -14,6 +14,19 @@
  * @note The ESP-EDU have 4 analog inputs and 1 analog output, but the designated pin for 
  * the latter is shared with analog output 0 (CH0).
  *
+ * Continuous mode samples one channel at a fixed rate with DMA: the callback function is called
+ * (from an ISR) each time a frame of ADC_CONT_FRAME_SAMPLES samples is ready, and the frame is
+ * read with AnalogInputReadContinuous(). If the callback wakes up a task, it should request the
+ * context switch with portYIELD_FROM_ISR(). Oversampling (ex: 20 kHz) and decimating the frames to
+ * the application rate (ex: DecimatorProcess() of the middelware) gives a lower noise signal
+ * with less CPU load than one timer interrupt and one single read per sample.
+ *
+ * @note ADC unit is shared: single reads and continuous mode can't be used at the same time.
+ *
+ * Reads return raw values. At init, the calibration curve of each channel is sampled into a
+ * piecewise-linear table (64 segments), so AnalogInputToMillivolts() converts blocks of
+ * samples to mV with integer operations only, instead of evaluating the curve for each sample.
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,6 +34,9 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 19/10/2026 | Continuous mode and calibrated conversion to mV                       |
+ * | 19/10/2026 | Calibration lookup table and block conversion to mV                   |
+ * | 19/10/2026 | Continuous mode callback optional, context switch requested by it     |
  * 
  **/
 
@@ -40,6 +56,8 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ADC_CONT_FRAME_SAMPLES	256		/*!< Samples per conversion frame (continuous mode) */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -50,7 +68,7 @@ typedef struct {
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
 	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint16_t sample_frec;	/*!< Sample frequency (Hz) min: 611Hz - max: 65535Hz (only for continuous mode)  */
 } analog_input_config_t;	
 
 /*==================[external data declaration]==============================*/
@@ -75,7 +93,7 @@ void AnalogOutputInit(void);
  * @brief Read single channel.
  * 
  * @param channel Channel selected
- * @param value Read variable pointer (in mV)
+ * @param value Read variable pointer (raw value, from 0 to 4095)
  * @return null
  */
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
@@ -95,12 +113,35 @@ void AnalogStartContinuous(adc_ch_t channel);
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the samples of a conversion frame (continuous mode), without blocking.
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (raw values, ADC_CONT_FRAME_SAMPLES lenght)
+ * @return uint16_t Number of samples read (0 if no frame is ready)
+ */
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Convert a block of raw values to mV with the calibration table of the channel.
+ * 
+ * @param channel Channel selected (initialized in single or continuous mode)
+ * @param raw Raw values array
+ * @param mv Converted values array (mV), can be the same as raw
+ * @param lenght Number of values to convert
+ */
+void AnalogInputToMillivolts(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint16_t lenght);
+
+/**
+ * @brief Convert a raw value to mV with the calibration table of the channel.
+ * 
+ * Raw values with fractional part (ex: averaged or decimated samples) are interpolated
+ * between the two nearest codes.
+ * 
+ * @param channel Channel selected (initialized in single or continuous mode)
+ * @param raw Raw value (from 0 to 4095)
+ * @return float Voltage (mV)
  */
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+float AnalogInputRawToMillivolts(adc_ch_t channel, float raw);
 
 /**
  * @brief Digital-to-Analog convert.
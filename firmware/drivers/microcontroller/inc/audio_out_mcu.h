@@ -0,0 +1,100 @@
+#ifndef AUDIO_OUT_MCU_H
+#define AUDIO_OUT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Audio_Out Audio output
+ ** @{ */
+
+/** \brief Audio output through DMA for the ESP-EDU Board.
+ *
+ * Audio is sent to the DAC pin (GPIO_0, shared with CH0) as a PDM bit stream generated by the
+ * I2S peripheral, so the analog output RC filter recovers the signal just as with
+ * AnalogOutputWrite(). Samples are taken from DMA: the CPU is only interrupted once per block,
+ * when a refill callback is called (from a task, not from an ISR) to get the next one.
+ *
+ * @note The audio output and AnalogOutputInit() can't be used at the same time.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * | 19/10/2026 | AudioOutStart() can be called from an ISR		                         	|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+#define AUDIO_BLOCK_MAX		1024	/*!< Maximum number of samples of a block */
+#define AUDIO_RATE_MIN		8000	/*!< Minimum sample rate (Hz) */
+#define AUDIO_RATE_MAX		48000	/*!< Maximum sample rate (Hz) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Sample formats
+ */
+typedef enum {
+	AUDIO_8BIT = 8,			/*!< uint8_t samples, 128 is silence (as AnalogOutputWrite()) */
+	AUDIO_16BIT = 16		/*!< int16_t samples, 0 is silence */
+} audio_bits_t;
+
+/**
+ * @brief Audio output config structure
+ */
+typedef struct {
+	uint32_t sample_rate;	/*!< Sample rate in Hz (AUDIO_RATE_MIN to AUDIO_RATE_MAX, multiple of 100) */
+	audio_bits_t bits;		/*!< Sample format */
+	uint16_t block_size;	/*!< Samples per block (AUDIO_BLOCK_MAX max) */
+	gpio_t clk;				/*!< PDM clock output: any free GPIO, it doesn't need to be connected */
+	void *func_p;			/*!< Refill callback: uint16_t (*)(void *block, uint16_t samples, void *param).
+								 It must write up to samples samples and return how many it wrote;
+								 less than samples ends the playback */
+	void *param_p;			/*!< Refill callback parameter */
+} audio_out_config_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Audio output initialization
+ *
+ * @note Output is silent until AudioOutStart() is called
+ *
+ * @param config Audio output config structure
+ */
+void AudioOutInit(audio_out_config_t *config);
+
+/**
+ * @brief Starts playback: blocks are requested from the refill callback until it returns
+ * less samples than requested or AudioOutStop() is called
+ *
+ * @note It can be called from an ISR (ex: a switch interrupt). The stream to play should be
+ * rewound by the refill callback, which runs in the audio task, not by the ISR.
+ */
+void AudioOutStart(void);
+
+/**
+ * @brief Stops playback (blocks already queued in DMA are played)
+ */
+void AudioOutStop(void);
+
+/**
+ * @brief Playback state
+ *
+ * @return true while blocks are being requested
+ */
+bool AudioOutIsPlaying(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef AUDIO_OUT_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -26,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | GPIODeactivInt() added		                         					|
  * 
  **/
 
@@ -134,6 +135,13 @@ bool GPIORead(gpio_t pin);
  */
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args);
 
+/**
+ * @brief Disable GPIO input interruption and remove its callback
+ * 
+ * @param pin GPIO number
+ */
+void GPIODeactivInt(gpio_t pin);
+
 /**
  * @brief Configure an input glitch filter to a GPIO
  * 
@@ -75,6 +75,9 @@ typedef struct{
 /**
  * @brief Initialize SPI module with the corresponding configuration
  * 
+ * @note Calling it again with the same configuration has no effect, so drivers sharing
+ * the SPI bus can call it before each access.
+ * 
  * @param spi Structure with the module configuration
  * @return uint8_t 
  */
@@ -108,6 +111,23 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Queue data to be written from SPI port (DMA), without waiting for the transfer to finish
+ * 
+ * @note Only one queued transfer per device: if there is one in progress, the function waits for it.
+ * The buffer must remain unchanged until the transfer finishes (see SpiWaitQueued()).
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer pointer to buffer where data is stored (must be in RAM)
+ * @param tx_buffer_size numbers of bytes to write
+ */
+void SpiWriteQueued(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
+/**
+ * @brief Wait for the transfer queued with SpiWriteQueued() to finish
+ * 
+ * @param device SPI device
+ */
+void SpiWaitQueued(spi_dev_t device);
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
@@ -19,13 +19,29 @@
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_MAX_CODE		((1 << ADC_BITWIDTH) - 1)
+#define ADC_CONT_BUFFER_FRAMES	4						// Frames stored by the continuous mode driver
+#define ADC_LUT_SEGMENT_BITS	6						// 64 codes per calibration table segment
+#define ADC_LUT_SEGMENT			(1 << ADC_LUT_SEGMENT_BITS)
+#define ADC_LUT_POINTS			((1 << ADC_BITWIDTH) / ADC_LUT_SEGMENT + 1)
+#define ADC_LUT_FRAC_BITS		8						// Calibration table values: mV * 256
 /*==================[internal data declaration]==============================*/
-adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
+adc_cali_handle_t adc_calibration_single_0 = NULL, adc_calibration_single_1 = NULL, adc_calibration_single_2 = NULL, adc_calibration_single_3 = NULL;
 adc_oneshot_unit_handle_t adc1_single; 
-adc_continuous_handle_t adc2_cont;
+adc_continuous_handle_t adc2_cont = NULL;
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
+uint32_t adc_lut[4][ADC_LUT_POINTS];	/*!< Piecewise-linear calibration curve of each channel (mV * 256) */
+void (*adc_cont_isr_p)(void*);			/*!< Pointer to the callback function for conversion frame end */
+void *adc_cont_user_data;				/*!< User data for conversion frame end callback */
 /*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR adc_cont_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	if(adc_cont_isr_p != NULL){
+		adc_cont_isr_p(adc_cont_user_data);
+	}
+	/* The callback requests its own context switch (portYIELD_FROM_ISR) */
+	return false;
+}
 
 /*==================[internal data definition]===============================*/
 adc_oneshot_unit_init_cfg_t init_config_single = {
@@ -35,10 +51,76 @@ adc_oneshot_unit_init_cfg_t init_config_single = {
 adc_oneshot_chan_cfg_t adc_config_single = {
 	.bitwidth = ADC_BITWIDTH,
 	.atten = ADC_ATTENUATION,
-};					
+};
+adc_continuous_handle_cfg_t init_config_cont = {
+	.max_store_buf_size = ADC_CONT_BUFFER_FRAMES * ADC_CONT_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES,
+	.conv_frame_size = ADC_CONT_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES,
+};
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief ADC channel of an ESP-EDU analog input
+ */
+static adc_channel_t AnalogChannel(adc_ch_t channel){
+	switch(channel){
+		case CH1:
+			return ADC_CHANNEL_1;
+		case CH2:
+			return ADC_CHANNEL_2;
+		case CH3:
+			return ADC_CHANNEL_3;
+		default:
+			return ADC_CHANNEL_0;
+	}
+}
+
+/**
+ * @brief Calibration handle of an ESP-EDU analog input
+ */
+static adc_cali_handle_t *AnalogCalibration(adc_ch_t channel){
+	switch(channel){
+		case CH1:
+			return &adc_calibration_single_1;
+		case CH2:
+			return &adc_calibration_single_2;
+		case CH3:
+			return &adc_calibration_single_3;
+		default:
+			return &adc_calibration_single_0;
+	}
+}
+
+/**
+ * @brief Creates the calibration curve of an analog input (once)
+ */
+static void AnalogCalibrationInit(adc_ch_t channel){
+	adc_cali_handle_t *calibration = AnalogCalibration(channel);
+	if(*calibration != NULL){
+		return;
+	}
+	adc_cali_curve_fitting_config_t cali_config = {
+		.unit_id = ADC_UNIT_1,
+		.chan = AnalogChannel(channel),
+		.atten = ADC_ATTENUATION,
+		.bitwidth = ADC_BITWIDTH,
+	};
+	ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config, calibration));
+	// sample the calibration curve every ADC_LUT_SEGMENT codes
+	int mv, mv_prev;
+	for(uint16_t i=0; i<ADC_LUT_POINTS; i++){
+		uint16_t code = i * ADC_LUT_SEGMENT;
+		if(code > ADC_MAX_CODE){
+			// last point (code 4096) extrapolated from the last two codes
+			adc_cali_raw_to_voltage(*calibration, ADC_MAX_CODE - 1, &mv_prev);
+			adc_cali_raw_to_voltage(*calibration, ADC_MAX_CODE, &mv);
+			mv += mv - mv_prev;
+		}else{
+			adc_cali_raw_to_voltage(*calibration, code, &mv);
+		}
+		adc_lut[channel][i] = (mv > 0) ? (uint32_t)mv << ADC_LUT_FRAC_BITS : 0;
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -51,68 +133,38 @@ void AnalogInputInit(analog_input_config_t *config){
 				adc_oneshot_new_unit(&init_config_single, &adc1_single);
 				adc1_single_used = true;
 			}
-			switch(config->input){
-				case CH0:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_0, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_0 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_0, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration_single_0));
-				break;
-				case CH1:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_1, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_1 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_1, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration_single_1));
-				break;
-				case CH2:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_2, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_2 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_2, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration_single_2));
-				break;
-				case CH3:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_3, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_3 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_3, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration_single_3));
-				break;
-			}
+			adc_oneshot_config_channel(adc1_single, AnalogChannel(config->input), &adc_config_single);
+			// create calibration curve
+			AnalogCalibrationInit(config->input);
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
+			adc_cont_isr_p = config->func_p;
+			adc_cont_user_data = config->param_p;
+			if(adc2_cont == NULL){
+				ESP_ERROR_CHECK(adc_continuous_new_handle(&init_config_cont, &adc2_cont));
+			}
+			adc_digi_pattern_config_t adc_pattern = {
+				.atten = ADC_ATTENUATION,
+				.channel = AnalogChannel(config->input),
+				.unit = ADC_UNIT_1,
+				.bit_width = ADC_BITWIDTH,
+			};
+			adc_continuous_config_t adc_config_cont = {
+				.pattern_num = 1,
+				.adc_pattern = &adc_pattern,
+				.sample_freq_hz = config->sample_frec,
+				.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+				.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+			};
+			ESP_ERROR_CHECK(adc_continuous_config(adc2_cont, &adc_config_cont));
+			if(adc_cont_isr_p != NULL){
+				adc_continuous_evt_cbs_t conv_done = {
+					.on_conv_done = adc_cont_isr,
+				};
+				adc_continuous_register_event_callbacks(adc2_cont, &conv_done, NULL);
 			}
+			// create calibration curve
+			AnalogCalibrationInit(config->input);
 		break;
 	}
 }
@@ -128,32 +180,64 @@ void AnalogOutputInit(void){
 }
 
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
-    switch(channel){
-		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
-		break;
-		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
-		break;
-		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
-		break;
-		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
-		break;
-	}
+	int raw = 0;
+	adc_oneshot_read(adc1_single, AnalogChannel(channel), &raw);
+	*value = raw;
 }
 
 void AnalogStartContinuous(adc_ch_t channel){
-
+	adc_continuous_start(adc2_cont);
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
+	adc_continuous_stop(adc2_cont);
+}
+
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	static uint8_t frame[ADC_CONT_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES];
+	uint32_t frame_size = 0;
+	uint16_t n = 0;
+
+	if(adc_continuous_read(adc2_cont, frame, sizeof(frame), &frame_size, 0) != ESP_OK){
+		return 0;
+	}
+	for(uint32_t i=0; i<frame_size; i+=SOC_ADC_DIGI_RESULT_BYTES){
+		adc_digi_output_data_t *result = (adc_digi_output_data_t*)&frame[i];
+		if(result->type2.channel == AnalogChannel(channel)){
+			values[n++] = result->type2.data;
+		}
+	}
+	return n;
+}
 
+void AnalogInputToMillivolts(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint16_t lenght){
+	const uint32_t *lut = adc_lut[channel];
+	uint32_t code, seg, frac;
+
+	for(uint16_t i=0; i<lenght; i++){
+		code = (raw[i] > ADC_MAX_CODE) ? ADC_MAX_CODE : raw[i];
+		seg = code >> ADC_LUT_SEGMENT_BITS;
+		frac = code & (ADC_LUT_SEGMENT - 1);
+		// linear interpolation between table points, rounded to mV
+		mv[i] = (lut[seg] * (ADC_LUT_SEGMENT - frac) + lut[seg + 1] * frac
+				+ (1 << (ADC_LUT_SEGMENT_BITS + ADC_LUT_FRAC_BITS - 1))) >> (ADC_LUT_SEGMENT_BITS + ADC_LUT_FRAC_BITS);
+	}
 }
 
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+float AnalogInputRawToMillivolts(adc_ch_t channel, float raw){
+	const uint32_t *lut = adc_lut[channel];
+	uint16_t seg;
+	float frac;
 
+	if(raw < 0){
+		raw = 0;
+	}
+	if(raw > ADC_MAX_CODE){
+		raw = ADC_MAX_CODE;
+	}
+	seg = (uint16_t)raw >> ADC_LUT_SEGMENT_BITS;
+	frac = (raw - (seg << ADC_LUT_SEGMENT_BITS)) / ADC_LUT_SEGMENT;
+	return (lut[seg] + frac * ((float)lut[seg + 1] - lut[seg])) / (1 << ADC_LUT_FRAC_BITS);
 }
 
 void AnalogOutputWrite(uint8_t value){
@@ -0,0 +1,137 @@
+/**
+ * @file audio_out_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Audio output through DMA (I2S PDM) for the ESP-EDU Board
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "audio_out_mcu.h"
+#include <string.h>
+#include "driver/i2s_pdm.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros and definitions]=================================*/
+#define AUDIO_DAC_GPIO		GPIO_0	/*!< Analog output pin (see analog_io_mcu.h) */
+#define AUDIO_DMA_BLOCKS	3		/*!< Blocks queued in DMA */
+#define AUDIO_PDM_FP		960		/*!< PDM up-sampling: PDM clock = 128 * 48 kHz for every sample rate */
+#define AUDIO_TASK_STACK	2048
+#define AUDIO_TASK_PRIO		15
+/*==================[internal data declaration]==============================*/
+static i2s_chan_handle_t audio_tx = NULL;
+static audio_out_config_t audio_cfg;
+static TaskHandle_t audio_task_handle = NULL;
+static volatile bool audio_playing = false;
+static int16_t audio_block[AUDIO_BLOCK_MAX];	/*!< Block being refilled */
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Refills blocks while playing. Writing a block blocks until DMA has room for it,
+ * which happens once per block played.
+ */
+static void AudioOutTask(void *pvParameter){
+	uint16_t (*refill)(void *, uint16_t, void *) = audio_cfg.func_p;
+	uint8_t *block8 = (uint8_t *)audio_block;
+	uint16_t n;
+	size_t written;
+
+	while (true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		while (audio_playing){
+			n = refill(audio_block, audio_cfg.block_size, audio_cfg.param_p);
+			if (n > audio_cfg.block_size){
+				n = audio_cfg.block_size;
+			}
+			if (audio_cfg.bits == AUDIO_8BIT){
+				/* In place, from the end: sample i is read before bytes 2i and 2i+1 are written */
+				for (int32_t i = n - 1; i >= 0; i--){
+					audio_block[i] = ((int16_t)block8[i] - 128) << 8;
+				}
+			}
+			if (n < audio_cfg.block_size){
+				/* End of stream: rest of the block is silence */
+				memset(&audio_block[n], 0, (audio_cfg.block_size - n) * sizeof(int16_t));
+				audio_playing = false;
+			}
+			i2s_channel_write(audio_tx, audio_block, audio_cfg.block_size * sizeof(int16_t), &written, portMAX_DELAY);
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+void AudioOutInit(audio_out_config_t *config){
+	audio_cfg = *config;
+	if (audio_cfg.block_size > AUDIO_BLOCK_MAX){
+		audio_cfg.block_size = AUDIO_BLOCK_MAX;
+	}
+	if (audio_cfg.sample_rate < AUDIO_RATE_MIN){
+		audio_cfg.sample_rate = AUDIO_RATE_MIN;
+	}
+	if (audio_cfg.sample_rate > AUDIO_RATE_MAX){
+		audio_cfg.sample_rate = AUDIO_RATE_MAX;
+	}
+
+	/* One DMA descriptor (and one interrupt) per block. Silence is sent when there is no data */
+	i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
+	chan_cfg.dma_desc_num = AUDIO_DMA_BLOCKS;
+	chan_cfg.dma_frame_num = audio_cfg.block_size;
+	chan_cfg.auto_clear = true;
+	i2s_new_channel(&chan_cfg, &audio_tx, NULL);
+
+	i2s_pdm_tx_config_t pdm_cfg = {
+		.clk_cfg = I2S_PDM_TX_CLK_DEFAULT_CONFIG(audio_cfg.sample_rate),
+		.slot_cfg = I2S_PDM_TX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+		.gpio_cfg = {
+			.clk = audio_cfg.clk,
+			.dout = AUDIO_DAC_GPIO,
+			.invert_flags = {
+				.clk_inv = false,
+			},
+		},
+	};
+	/* Same PDM clock for every sample rate, so the output filter always works the same way */
+	pdm_cfg.clk_cfg.up_sample_fp = AUDIO_PDM_FP;
+	pdm_cfg.clk_cfg.up_sample_fs = audio_cfg.sample_rate / 100;
+	i2s_channel_init_pdm_tx_mode(audio_tx, &pdm_cfg);
+	i2s_channel_enable(audio_tx);
+
+	if (audio_task_handle == NULL){
+		xTaskCreate(AudioOutTask, "audio", AUDIO_TASK_STACK, NULL, AUDIO_TASK_PRIO, &audio_task_handle);
+	}
+}
+
+void AudioOutStart(void){
+	BaseType_t higher_prio_woken = pdFALSE;
+
+	if (!audio_playing){
+		audio_playing = true;
+		if (xPortInIsrContext()){
+			vTaskNotifyGiveFromISR(audio_task_handle, &higher_prio_woken);
+			portYIELD_FROM_ISR(higher_prio_woken);
+		}else{
+			xTaskNotifyGive(audio_task_handle);
+		}
+	}
+}
+
+void AudioOutStop(void){
+	audio_playing = false;
+}
+
+bool AudioOutIsPlaying(void){
+	return audio_playing;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
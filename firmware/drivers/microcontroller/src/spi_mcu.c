@@ -39,6 +39,10 @@ void (*spi_3_isr_p)(void*);	/*!<  */
 void *spi_1_user_data;	    /*!<  */
 void *spi_2_user_data;	    /*!<  */
 void *spi_3_user_data;	    /*!<  */
+static spi_mcu_config_t spi_cfg[3];         /*!< Last configuration of each device */
+static bool spi_added[3] = {false};         /*!< Device added to the bus */
+static spi_transaction_t spi_queued[3];     /*!< Transfer queued by SpiWriteQueued() */
+static bool spi_pending[3] = {false};       /*!< Queued transfer not finished yet */
 /*==================[internal functions declaration]=========================*/
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
 	spi_1_isr_p(spi_1_user_data);
@@ -54,6 +58,25 @@ static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static spi_device_handle_t SpiHandle(spi_dev_t device){
+    switch(device){
+        case SPI_1:
+            return spi_1;
+        case SPI_2:
+            return spi_2;
+        case SPI_3:
+            return spi_3;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Compares two configurations field by field (memcmp would also compare the struct padding)
+ */
+static bool SpiSameConfig(const spi_mcu_config_t *a, const spi_mcu_config_t *b){
+    return (a->device == b->device) && (a->clk_mode == b->clk_mode) && (a->bitrate == b->bitrate) &&
+           (a->transfer_mode == b->transfer_mode) && (a->func_p == b->func_p) && (a->param_p == b->param_p);
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
@@ -62,6 +85,15 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 	    spi_bus_initialize(SPI2_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
         spi_initialized = true;
     }
+    if(spi_added[spi->device]){
+        if(SpiSameConfig(&spi_cfg[spi->device], spi)){
+            return 0;
+        }
+        SpiWaitQueued(spi->device);
+        spi_bus_remove_device(SpiHandle(spi->device));
+    }
+    spi_cfg[spi->device] = *spi;
+    spi_added[spi->device] = true;
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
@@ -104,6 +136,7 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 
 void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     spi_transaction_t t;
+    SpiWaitQueued(device);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
@@ -144,6 +177,7 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     spi_transaction_t t;
+    SpiWaitQueued(device);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.tx_buffer = tx_buffer;        // Data
@@ -183,6 +217,7 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
     spi_transaction_t t;
+    SpiWaitQueued(device);
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = buffer_size * 8;
@@ -222,6 +257,23 @@ void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, ui
     }
 }
 
+void SpiWriteQueued(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
+    SpiWaitQueued(device);
+    memset(&spi_queued[device], 0, sizeof(spi_transaction_t));
+    spi_queued[device].length = tx_buffer_size * 8;
+    spi_queued[device].tx_buffer = tx_buffer;
+    spi_device_queue_trans(SpiHandle(device), &spi_queued[device], portMAX_DELAY);
+    spi_pending[device] = true;
+}
+
+void SpiWaitQueued(spi_dev_t device){
+    spi_transaction_t *t;
+    if(spi_pending[device]){
+        spi_device_get_trans_result(SpiHandle(device), &t, portMAX_DELAY);
+        spi_pending[device] = false;
+    }
+}
+
 uint8_t SpiDeInit(spi_dev_t device){
     return 0;
 }
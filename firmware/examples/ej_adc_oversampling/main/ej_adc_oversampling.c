@@ -0,0 +1,100 @@
+/*! @mainpage Ejemplo ADC sobremuestreado
+ *
+ * @section genDesc General Description
+ *
+ * Este proyecto ejemplifica la adquisición de señales biológicas con sobremuestreo.
+ * El ADC convierte el canal CH1 en modo continuo a 20 kHz (sin intervención del CPU,
+ * por DMA). Cada trama de ADC_CONT_FRAME_SAMPLES muestras se decima con un filtro CIC
+ * (sólo sumas y restas enteras) seguido de un FIR de compensación, obteniendo una señal
+ * de 250 Hz con menor ruido y más bits efectivos que una lectura simple por muestra.
+ * Finalmente se aplica la curva de calibración del ADC para obtener la tensión en mV.
+ *
+ * Por cada muestra de salida se imprime la tensión de una única conversión (equivalente
+ * a leer el ADC con un timer a 250 Hz) y la tensión de la señal sobremuestreada.
+ *
+ * \section hardConn Hardware Connection
+ *
+ * |    Señal		|   ESP-EDU		|
+ * |:--------------:|:--------------|
+ * | 	Entrada	 	| 	CH1			|
+ * | 	GND		 	| 	GND			|
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "analog_io_mcu.h"
+#include "resampler.h"
+/*==================[macros and definitions]=================================*/
+#define ADC_SAMPLE_FREQ     20000   /* Frecuencia de muestreo del ADC (Hz) */
+#define CIC_RATIO           40      /* 20 kHz -> 500 Hz */
+#define CIC_ORDER           3
+#define FIR_RATIO           2       /* 500 Hz -> 250 Hz */
+#define FIR_TAPS            32
+#define PASSBAND            0.4f    /* Banda de paso: 0.4 * 250 Hz = 100 Hz */
+#define OUT_MAX             (ADC_CONT_FRAME_SAMPLES / (CIC_RATIO * FIR_RATIO) + 1)
+/*==================[internal data definition]===============================*/
+TaskHandle_t adc_task_handle = NULL;
+static uint16_t adc_frame[ADC_CONT_FRAME_SAMPLES];
+static float signal_out[OUT_MAX];
+static decimator_t decimator = {
+    .cic_ratio = CIC_RATIO,
+    .cic_order = CIC_ORDER,
+    .fir_ratio = FIR_RATIO,
+    .fir_taps = FIR_TAPS,
+    .passband = PASSBAND,
+};
+/*==================[internal functions declaration]=========================*/
+void FuncAdcFrame(void* param){
+    BaseType_t higher_prio_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(adc_task_handle, &higher_prio_woken);
+    portYIELD_FROM_ISR(higher_prio_woken);
+}
+
+static void AdcTask(void *pvParameter){
+    uint16_t n_frame, n_out;
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        /* Se leen todas las tramas disponibles */
+        while((n_frame = AnalogInputReadContinuous(CH1, adc_frame)) > 0){
+            /* Los valores crudos (12 bits) entran en un int16_t */
+            n_out = DecimatorProcess(&decimator, (const int16_t*)adc_frame, signal_out, n_frame);
+            for(uint16_t i=0; i<n_out; i++){
+                printf("%.1f, %.2f\n", AnalogInputRawToMillivolts(CH1, adc_frame[n_frame - 1]),
+                       AnalogInputRawToMillivolts(CH1, signal_out[i]));
+            }
+        }
+    }
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    analog_input_config_t adc_config = {
+        .input = CH1,
+        .mode = ADC_CONTINUOUS,
+        .func_p = FuncAdcFrame,
+        .param_p = NULL,
+        .sample_frec = ADC_SAMPLE_FREQ
+    };
+
+    DecimatorInit(&decimator);
+    AnalogInputInit(&adc_config);
+    printf("Simple (mV), Sobremuestreada (mV)\n");
+
+    xTaskCreate(&AdcTask, "ADC", 4096, NULL, 5, &adc_task_handle);
+    AnalogStartContinuous(CH1);
+}
+
+/*==================[end of file]============================================*/
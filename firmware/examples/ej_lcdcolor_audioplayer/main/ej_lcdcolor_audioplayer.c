@@ -29,6 +29,11 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 19/10/2026 | Display managed with retained widgets          |
+ * | 19/10/2026 | Audio played through DMA, one block at a time  |
+ * | 19/10/2026 | IMA-ADPCM compressed songs (see wav_to_edu.py) |
+ * | 19/10/2026 | VU meter with log spaced bands                 |
+ * | 19/10/2026 | Song rewound in the audio task, not in the ISR |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -40,10 +45,9 @@
 #include <string.h>
 #include <math.h>
 
-#include "timer_mcu.h"
 #include "gpio_mcu.h"
 #include "rtc_mcu.h"
-#include "analog_io_mcu.h"
+#include "audio_out_mcu.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -51,91 +55,169 @@
 #include "switch.h"
 #include "ili9341.h"
 
-#include "vumeter.h"
+#include "lcd_widgets.h"
 #include "song.h"
 
 #include "fft.h"
+#include "band_analyzer.h"
+#ifdef SONG_ADPCM
+#include "adpcm.h"
+#endif
 /*==================[macros and definitions]=================================*/
 #define SAMPLE_FREQ	        8000        /* 8 kSPS */
-#define T_SENIAL            125         /* 0.125 ms */
+#define AUDIO_BLOCK         256         /* muestras por bloque DMA */
 #define CHUNK               1024 
-#define MAX_DAC             256        /* DAC: 8 bits*/
 #define VUM_BARS            16
 #define COLOR_MAIN_1        0x3e98
 #define COLOR_MAIN_2        0x5419
 #define COLOR_MAIN_3        0x6ab8
 #define COLOR_MAIN_4        0x71b9
 #define COLOR_BG_1          0x0884
+#define N_CHUNKS            (N_SONG / CHUNK)
 /*==================[internal data definition]===============================*/
 TaskHandle_t plot_task_handle = NULL;
-static float fft[CHUNK/2];
+static float power[CHUNK/2];
 static float chunk[CHUNK];
+static int16_t played[2][CHUNK];   /* últimos segmentos reproducidos (para el análisis) */
+#ifdef SONG_ADPCM
+static adpcm_t song_stream;
+#endif
 static uint32_t song_index = 0;
 static bool reset = false;
+static volatile bool start = false;    /* reproducción pedida por la tecla, aún no iniciada */
+/* Pantalla */
+/* Vúmetro: bandas logarítmicas de 60 Hz a 4 kHz */
+static band_analyzer_t analyzer = {
+    .n_bands = VUM_BARS,
+    .scale = BAND_SCALE_LOG,
+    .sample_freq = SAMPLE_FREQ,
+    .signal_lenght = CHUNK,
+    .f_min = 60,
+    .f_max = SAMPLE_FREQ / 2,
+    .floor_db = 20,
+    .range_db = 36,
+    .attack = 0.7,
+    .decay = 3,
+    .peak_hold = 8,
+    .peak_decay = 1
+};
+static widget_label_t title = {
+    .base = {.y_pos = 45, .back_color = COLOR_BG_1},
+    .font = &font_22,
+    .color = COLOR_MAIN_1
+};
+static widget_label_t artist = {
+    .base = {.y_pos = 75, .back_color = COLOR_BG_1},
+    .font = &font_19,
+    .color = COLOR_MAIN_2
+};
+static widget_icon_t play = {
+    .base = {.x_pos = 106, .y_pos = 255, .back_color = COLOR_BG_1},
+    .icon_font = &icon_30,
+    .icon = ICON_PLAY,
+    .color = COLOR_MAIN_1
+};
+static widget_bar_t vum = {
+    .base = {.x_pos = 20, .y_pos = 100, .back_color = COLOR_BG_1},
+    .width = 200,
+    .height = 100,
+    .n_bars = VUM_BARS,
+    .step_height = 6,
+    .step_pitch = 7,
+    .colors = {COLOR_MAIN_1, COLOR_MAIN_2, COLOR_MAIN_3, COLOR_MAIN_4},
+    .thresholds = {30, 60, 80}
+};
+static widget_progress_t progress = {
+    .base = {.x_pos = 20, .y_pos = 220, .back_color = COLOR_BG_1},
+    .width = 201,
+    .height = 7,
+    .track_color = COLOR_MAIN_1,
+    .color = COLOR_MAIN_2,
+    .knob_color = COLOR_MAIN_3,
+    .knob_radius = 7,
+    .max = N_CHUNKS
+};
+static widget_t *widgets[] = {&title.base, &artist.base, &play.base, &vum.base, &progress.base};
+static widget_screen_t screen = {
+    .widgets = widgets,
+    .n_widgets = sizeof(widgets) / sizeof(widgets[0])
+};
 /*==================[internal functions declaration]=========================*/
 /**
  * @brief Función ejecutada en la interrupción de la tecla 1.
- * Inicializa el Timer.
+ * Sólo pide el inicio de la reproducción: la canción se rebobina en
+ * FuncAudioRefill(), desde la tarea de audio.
  * 
  */
 void FuncSwitchStart(void *param){
-    reset = false;
-    TimerStart(TIMER_B);
+    if(!AudioOutIsPlaying()){
+        start = true;
+        AudioOutStart();
+    }
 }
 
 /**
- * @brief Función ejecutada en la interrupción del Timer. 
- * Reproduce la señal de audio mediante el DAC.
+ * @brief Función llamada por el driver de audio cada vez que necesita un
+ * nuevo bloque de muestras (una vez cada AUDIO_BLOCK muestras reproducidas).
  * 
+ * @param block Bloque a completar
+ * @param samples Cantidad de muestras pedidas
+ * @return Cantidad de muestras escritas (menos que samples termina la reproducción)
  */
-void FuncTimerSenial(void* param){
-    AnalogOutputWrite(song[song_index]);
-    song_index++;
-    if(song_index%CHUNK == 0){
-        /* Graficar cada 1024 (CHUNK) muestras reproducidas */
+uint16_t FuncAudioRefill(void *block, uint16_t samples, void *param){
+    int16_t *out = block;
+    uint16_t n = samples;
+    if(start){
+        /* Primer bloque: se rebobina la canción */
+        start = false;
+        song_index = 0;
+        reset = false;
+#ifdef SONG_ADPCM
+        AdpcmInit(&song_stream, song_adpcm, N_SONG);
+#endif
+    }
+#ifdef SONG_ADPCM
+    /* Decodificación de las muestras a medida que se reproducen */
+    n = AdpcmDecode(&song_stream, out, samples);
+#else
+    if(N_SONG - song_index < n){
+        n = N_SONG - song_index;
+    }
+    /* Muestras de 8 bits (128 = silencio) a 16 bits */
+    for(uint16_t i=0; i<n; i++){
+        out[i] = ((int16_t)song[song_index + i] - 128) << 8;
+    }
+#endif
+    /* Copia para el análisis espectral (AUDIO_BLOCK es divisor de CHUNK) */
+    memcpy(&played[(song_index / CHUNK) % 2][song_index % CHUNK], out, n * sizeof(int16_t));
+    song_index += n;
+    if(n > 0 && song_index%CHUNK == 0){
+        /* Graficar cada 1024 (CHUNK) muestras */
         xTaskNotifyGive(plot_task_handle);
     }
-    if(song_index == N_SONG){
-        song_index = 0;
-        TimerStop(TIMER_B);
+    if(n < samples){
         reset = true;
         /* Resetear pantalla */
         xTaskNotifyGive(plot_task_handle);
     }
+    return n;
 }
 
 /**
  * @brief Calcula la altura de cada una de las barras del vúmetro a partir
  * del análisis de un segmento de la señal.
  * 
- * @param song Puntero a segmento de la señal
+ * @param song Puntero a segmento de la señal (16 bits)
  * @param bars Puntero a array con la altura de las barras
  */
-void Song2Bars(const uint8_t* song, uint8_t* bars){
-    float aux;
-    uint16_t steps;
-
-    /* Restar continua */
+void Song2Bars(const int16_t* song, uint8_t* bars){
     for(uint16_t i=0; i<CHUNK; i++){
-        chunk[i] = song[i] - (MAX_DAC/2);
-    }
-    /* Calculo de FFT */
-    FFTMagnitude(chunk, fft, CHUNK);
-    /* Calcular la altura de las barras a partir de los valores de la FFT */
-    steps = (CHUNK / 2) / VUM_BARS;
-    for(uint8_t i=0; i<VUM_BARS; i++){
-        aux = 0;
-        for(uint16_t j=0; j<steps; j++){
-            /* Acumulado para cada barra */
-            aux += fft[steps*i+j] / steps;
-        }
-        aux = aux * 100;      /* ajustar en pantalla */
-        if(aux < 255){
-            bars[i] = (uint8_t) aux;
-        }else{
-            bars[i] = 255;
-        }
+        chunk[i] = song[i];
     }
+    /* Espectro de potencia (sin raíces cuadradas) */
+    FFTPower(chunk, power, CHUNK);
+    /* Potencia de cada banda a altura de barra (con ataque y caída) */
+    BandAnalyzerUpdate(&analyzer, power, bars, NULL);
 }
 
 /**
@@ -144,84 +226,70 @@ void Song2Bars(const uint8_t* song, uint8_t* bars){
  * @param pvParameter 
  */
 static void PlotTask(void *pvParameter){
-    vumeter_t* vum = (vumeter_t*)pvParameter; 
-    static uint16_t progress_bar, progress_bar_index = 0;
     static uint8_t bars[VUM_BARS];
-    progress_bar = N_SONG / CHUNK;
     
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
         if(!reset){
-            if(song_index-CHUNK == 0){
-                /* Título canción */
-                uint16_t width, height;
-                ILI9341GetStringSize(SONG_NAME, &font_22, &width, &height);
-                ILI9341DrawString(120-width/2, 45, SONG_NAME, &font_22, COLOR_MAIN_1, COLOR_BG_1);
-                ILI9341GetStringSize(SONG_ARTIST, &font_19, &width, &height);
-                ILI9341DrawString(120-width/2, 75, SONG_ARTIST, &font_19, COLOR_MAIN_2, COLOR_BG_1);
-                ILI9341DrawIcon(105, 255, ICON_PAUSE, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
-            }
+            /* Título canción (sólo se dibuja la primera vez) */
+            WidgetLabelSet(&title, SONG_NAME);
+            WidgetLabelSet(&artist, SONG_ARTIST);
+            WidgetIconSet(&play, ICON_PAUSE, COLOR_MAIN_1);
             /* Vúmetro */
-            Song2Bars(&song[song_index-CHUNK], bars);
-            VumeterUpdate(vum, bars);
+            Song2Bars(played[(song_index / CHUNK - 1) % 2], bars);
+            WidgetBarSet(&vum, bars);
             /* Progress bar */
-            ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_BG_1);
-            progress_bar_index++;
-            ILI9341DrawFilledRectangle(20, 220, 20+200*progress_bar_index/progress_bar, 226, COLOR_MAIN_2);
-            ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_MAIN_3);
+            WidgetProgressSet(&progress, song_index / CHUNK);
         }else{
             /* Resetear pantalla */
-            ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_BG_1);
-            ILI9341DrawFilledRectangle(20, 220, 20+200*progress_bar_index/progress_bar, 226, COLOR_BG_1);
-            ILI9341DrawRectangle(20, 220, 220, 226, COLOR_MAIN_1);
-            ILI9341DrawIcon(107, 255, ICON_PLAY, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
-            ILI9341DrawFilledRectangle(0, 45, 240, 100, COLOR_BG_1);
-            VumeterInit(vum);
-            progress_bar_index = 0;
-        }     
+            WidgetLabelSet(&title, "");
+            WidgetLabelSet(&artist, "");
+            WidgetIconSet(&play, ICON_PLAY, COLOR_MAIN_1);
+            memset(bars, 0, sizeof(bars));
+            WidgetBarSet(&vum, bars);
+            WidgetProgressSet(&progress, 0);
+        }
+        /* Sólo se dibuja lo que cambió */
+        WidgetScreenRender(&screen);
     }
 }
 /*==================[external functions definition]==========================*/
 void app_main(void){
-    /* Configuración de timer */
-    timer_config_t timer_senial = {
-        .timer = TIMER_B,
-        .period = T_SENIAL,
-        .func_p = FuncTimerSenial,
+    /* Salida de audio: el DMA reproduce bloques de AUDIO_BLOCK muestras */
+    audio_out_config_t audio = {
+        .sample_rate = SAMPLE_FREQ,
+        .bits = AUDIO_16BIT,
+        .block_size = AUDIO_BLOCK,
+        .clk = GPIO_23,
+        .func_p = FuncAudioRefill,
         .param_p = NULL
     };
-    TimerInit(&timer_senial);
-    /* DAC */
-    AnalogOutputInit();
+    AudioOutInit(&audio);
     /* FFT */
     FFTInit();
+    BandAnalyzerInit(&analyzer);
 
     /* Configuración de display */
     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
 	ILI9341Rotate(ILI9341_Portrait_2);
 	ILI9341Fill(0x0884);
-    /* Vúmmetro */
-    static vumeter_t v = {
-        .x_pos = 20,
-        .y_pos = 100,
-        .width = 200,
-        .height = 100,
-        .n_bars = VUM_BARS,
-        .step_color_1 = COLOR_MAIN_1,
-        .step_color_2 = COLOR_MAIN_2,
-        .step_color_3 = COLOR_MAIN_3,
-        .step_color_4 = COLOR_MAIN_4,
-        .back_color = COLOR_BG_1
-    };
-    VumeterInit(&v);
+    /* Widgets: los títulos se centran en pantalla */
+    uint16_t width, height;
+    ILI9341GetStringSize(SONG_NAME, &font_22, &width, &height);
+    title.base.x_pos = 120 - width/2;
+    ILI9341GetStringSize(SONG_ARTIST, &font_19, &width, &height);
+    artist.base.x_pos = 120 - width/2;
+    WidgetLabelInit(&title, "");
+    WidgetLabelInit(&artist, "");
+    WidgetIconInit(&play);
+    WidgetBarInit(&vum);
+    WidgetProgressInit(&progress);
+    WidgetScreenRender(&screen);
     /* Iconos */
     ILI9341DrawString(10, 8, "10:20", &font_22, COLOR_MAIN_2, COLOR_BG_1);
     ILI9341DrawIcon(180, 8, ICON_WIFI_3, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
     ILI9341DrawIcon(210, 8, ICON_BAT_3, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
-    /* Progress bar */
-    ILI9341DrawRectangle(20, 220, 220, 226, COLOR_MAIN_1);
     /* Botones */
-    ILI9341DrawIcon(107, 255, ICON_PLAY, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
     ILI9341DrawIcon(163, 259, ICON_FAST_FOWARD, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
     ILI9341DrawIcon(55, 259, ICON_REWIND, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
     ILI9341DrawIcon(204, 259, ICON_JUMP_END, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
@@ -243,7 +311,7 @@ void app_main(void){
     SwitchActivInt(SWITCH_1, FuncSwitchStart, NULL);
     
     /* Tarea para actualizar pantalla */
-    xTaskCreate(&PlotTask, "Plot", 32768, &v, 5, &plot_task_handle);
+    xTaskCreate(&PlotTask, "Plot", 32768, NULL, 5, &plot_task_handle);
 }
 
 /*==================[end of file]============================================*/
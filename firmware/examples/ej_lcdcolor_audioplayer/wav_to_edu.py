@@ -12,6 +12,51 @@ import numpy as np
 import matplotlib.pyplot as plt
 # from funciones_fft import fft_mag
 
+# %% Codificador IMA-ADPCM (4 bits por muestra, ver adpcm.h)
+ADPCM_STEPS = [7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37,
+               41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157,
+               173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544,
+               598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707,
+               1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871,
+               5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635,
+               13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+ADPCM_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+def adpcm_encode(x):
+    """
+    Codifica muestras de 16 bits en IMA-ADPCM. El predictor se actualiza igual
+    que en el decodificador del firmware, por lo que ambos siguen la misma señal.
+    Devuelve un byte cada dos muestras (primera muestra en el nibble bajo).
+    """
+    pred = 0
+    index = 0
+    codes = np.zeros(len(x) + (len(x) % 2), dtype=np.uint8)
+    for i, muestra in enumerate(x):
+        step = ADPCM_STEPS[index]
+        diff = int(muestra) - pred
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        # Cuantización por aproximaciones sucesivas (bits 2, 1 y 0)
+        dq = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            dq += step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+            dq += step >> 1
+        if diff >= step >> 2:
+            code |= 1
+            dq += step >> 2
+        pred = pred - dq if code & 8 else pred + dq
+        pred = min(max(pred, -32768), 32767)
+        index = min(max(index + ADPCM_INDEX[code & 7], 0), 88)
+        codes[i] = code
+    return codes[0::2] | (codes[1::2] << 4)
+
 plt.close('all') # cerrar gráficas anteriores
 
 # %% Lectura del archivo de audio 
@@ -47,14 +92,32 @@ N_rec = len(senial_rec)
 F_SUB = 8000
 senial_submuest = signal.resample(senial_rec, int(N_rec*F_SUB/fs))
 
-# Escalado (para DAC de 8 bits)
-senial_esc = senial_submuest / np.max(np.abs(senial_submuest))
-senial_esc = (senial_esc * (127) + 128).astype(np.int16)
-N_esc = len(senial_esc)
-
-# Guardado en archivo .h
-np.savetxt("song.h", senial_esc, newline=',', 
-            header=f'#define N_SONG {N_esc}\n#define SONG_NAME "Mariposa Teknicolor"\n#define SONG_ARTIST "Fito Paez"\nconst uint8_t song[] ='+' {128',
-            footer='};//',
-            comments='',
-            )
\ No newline at end of file
+# Formato de salida:
+#   'pcm8':  8 bits por muestra (1 byte por muestra)
+#   'adpcm': IMA-ADPCM, calidad de 16 bits con 4 bits por muestra (1 byte cada 2 muestras)
+FORMATO = 'adpcm'
+
+senial_norm = senial_submuest / np.max(np.abs(senial_submuest))
+if FORMATO == 'pcm8':
+    # Escalado (para DAC de 8 bits)
+    senial_esc = (senial_norm * (127) + 128).astype(np.int16)
+    N_esc = len(senial_esc)
+
+    # Guardado en archivo .h
+    np.savetxt("song.h", senial_esc, newline=',', 
+                header=f'#define N_SONG {N_esc}\n#define SONG_NAME "Mariposa Teknicolor"\n#define SONG_ARTIST "Fito Paez"\nconst uint8_t song[] ='+' {128',
+                footer='};//',
+                comments='',
+                )
+else:
+    # Escalado a 16 bits y codificación
+    senial_esc = (senial_norm * 32767).astype(np.int16)
+    N_esc = len(senial_esc)
+    song_adpcm = adpcm_encode(senial_esc)
+
+    # Guardado en archivo .h
+    np.savetxt("song.h", song_adpcm[1:], fmt='%d', newline=',', 
+                header=f'#define N_SONG {N_esc}\n#define SONG_ADPCM\n#define SONG_NAME "Mariposa Teknicolor"\n#define SONG_ARTIST "Fito Paez"\nconst uint8_t song_adpcm[] ='+f' {{{song_adpcm[0]}',
+                footer='};//',
+                comments='',
+                )
@@ -27,6 +27,10 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 05/04/2024 | Document creation		                         |
+ * | 19/10/2026 | Landscape layout, hardware scrolled plot       |
+ * | 19/10/2026 | Display managed with retained widgets          |
+ * | 19/10/2026 | Heart rate from QRS detection                  |
+ * | 19/10/2026 | Compressed heart picture                       |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -39,6 +43,7 @@
 #include "sys/time.h"
 
 #include "iir_filter.h"
+#include "qrs_detector.h"
 #include "timer_mcu.h"
 #include "gpio_mcu.h"
 #include "rtc_mcu.h"
@@ -48,14 +53,17 @@
 
 #include "switch.h"
 #include "ili9341.h"
-#include "roll_plot.h"
+#include "lcd_widgets.h"
 #include "heart_pic.h"
 /*==================[macros and definitions]=================================*/
 #define BUFFER_SIZE         256
-#define SAMPLE_FREQ	        200
 #define T_SENIAL            4000 
+#define SAMPLE_FREQ	        (1000000 / T_SENIAL)
 #define CHUNK               16 
 #define LIGHT_BLUE_COLOR    0x0B2F
+#define PLOT_WIDTH          220
+#define PANEL_X             PLOT_WIDTH
+#define BEAT_CHUNKS         3           /* bloques que se muestra el corazón en cada latido */
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -81,7 +89,10 @@ float ecg[] = {
 };
 static float ecg_filt[CHUNK];
 TaskHandle_t plot_task_handle = NULL;
-uint8_t frecuencia_cardiaca = 71;
+uint8_t frecuencia_cardiaca = 0;
+static qrs_detector_t qrs = {
+    .sample_freq = SAMPLE_FREQ
+};
 /*==================[internal functions declaration]=========================*/
 /**
  * @brief Función ejecutada en la interrupción del Timer
@@ -98,30 +109,61 @@ void FuncTimerSenial(void* param){
  */
 static void PlotTask(void *pvParameter){
     static uint8_t indice = 0;
-    static char freq[] = "000";
     static char hour_min[] = "00:00";
-    static bool beat = true;
+    static uint8_t beat = 0;
     rtc_t actual_time;
+    int16_t sample;
 
-    /* Configuración de área de gráfica */
-    plot_t plot1 = {
-        .x_pos = 0,
-        .y_pos = 160,
-        .width = 240,
-        .height = 100,
-        .x_scale = 30,
-        .back_color = ILI9341_WHITE
+    /* Gráfica: se desplaza por hardware */
+    static widget_trace_t ecg1 = {
+        .y_scale = 80,
+        .y_offset = 100,
+        .color = ILI9341_RED
 	};
-	RTPlotInit(&plot1); 
-    /* Configuración de señal a graficar */
-    signal_t ecg1 = {
-        .y_scale = 40,
-        .y_offset = 50,
-        .color = ILI9341_RED,
-        .x_prev = 0,
-        .y_prev = 0
+    static widget_strip_t chart1 = {
+        .base = {.x_pos = 0, .y_pos = 0, .back_color = ILI9341_WHITE},
+        .width = PLOT_WIDTH,
+        .height = 240,
+        .x_scale = 50,
+        .n_traces = 1,
+        .traces = &ecg1
 	};
-	RTSignalInit(&plot1, &ecg1);
+    /* Datos: sólo se redibujan los dígitos que cambian */
+    static widget_number_t bpm = {
+        .base = {.x_pos = PANEL_X + 5, .y_pos = 60, .back_color = ILI9341_WHITE},
+        .font = &font_59,
+        .color = LIGHT_BLUE_COLOR,
+        .digits = 3,
+        .zero_pad = true
+    };
+    static widget_label_t clock = {
+        .base = {.x_pos = PANEL_X + 5, .y_pos = 8, .back_color = LIGHT_BLUE_COLOR},
+        .font = &font_30,
+        .color = ILI9341_WHITE
+    };
+    static widget_icon_t bluetooth = {
+        .base = {.x_pos = PANEL_X + 15, .y_pos = 205, .back_color = LIGHT_BLUE_COLOR},
+        .icon_font = &icon_30,
+        .icon = ICON_BLUETOOTH,
+        .color = ILI9341_WHITE
+    };
+    static widget_icon_t battery = {
+        .base = {.x_pos = PANEL_X + 55, .y_pos = 205, .back_color = LIGHT_BLUE_COLOR},
+        .icon_font = &icon_30,
+        .icon = ICON_BAT_3,
+        .color = ILI9341_WHITE
+    };
+    static widget_t *widgets[] = {&chart1.base, &bpm.base, &clock.base, &bluetooth.base, &battery.base};
+    static widget_screen_t screen = {
+        .widgets = widgets,
+        .n_widgets = sizeof(widgets) / sizeof(widgets[0])
+    };
+    WidgetStripInit(&chart1);
+    WidgetNumberInit(&bpm, frecuencia_cardiaca);
+    WidgetLabelInit(&clock, hour_min);
+    WidgetIconInit(&bluetooth);
+    WidgetIconInit(&battery);
+    WidgetScreenRender(&screen);
 
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
@@ -132,26 +174,31 @@ static void PlotTask(void *pvParameter){
 
         /* Graficación de señal */
         for(uint8_t i=0; i<CHUNK; i++){
-            RTPlotDraw(&ecg1, ecg_filt[i]);
+            sample = ecg_filt[i];
+            WidgetStripPush(&chart1, &sample);
+        }
+
+        /* Detección de latidos (sobre la señal sin filtrar: el detector tiene su propio filtro) */
+        if(QrsDetectorProcess(&qrs, &ecg[indice], CHUNK, NULL) > 0){
+            frecuencia_cardiaca = QrsDetectorHeartRate(&qrs);
+            WidgetNumberSet(&bpm, frecuencia_cardiaca);
+            if(beat == 0){
+                ILI9341DrawCompressedPicture(PANEL_X + 24, 148, &heart);
+            }
+            beat = BEAT_CHUNKS;
+        }else if(beat > 0 && --beat == 0){
+            ILI9341DrawFilledRectangle(PANEL_X + 24, 148, PANEL_X + 24 + heart.width, 148 + heart.height, ILI9341_WHITE);
         }
         indice += CHUNK;
 
         if(indice == 0){
             /* Actualización de datos en display */
-            ILI9341DrawString(20, 60, freq, &font_89, ILI9341_WHITE, ILI9341_WHITE);
-            ILI9341DrawString(10, 8, hour_min, &font_30, LIGHT_BLUE_COLOR, LIGHT_BLUE_COLOR);
-            sprintf(freq, "%03i", frecuencia_cardiaca);
             RtcRead(&actual_time);
             sprintf(hour_min, "%02i:%02i", actual_time.hour%MAX_HOUR, actual_time.min%MAX_MIN);
-            ILI9341DrawString(20, 60, freq, &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-            ILI9341DrawString(10, 8, hour_min, &font_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-            if(beat){
-                ILI9341DrawPicture(170, 65, HEART_WIDTH, HEART_HEIGHT, heart);
-            }else{
-                ILI9341DrawFilledRectangle(170, 65, 170+HEART_WIDTH, 65+HEART_HEIGHT, ILI9341_WHITE);
-            }
-            beat = !beat;
+            WidgetLabelSet(&clock, hour_min);
         }
+        /* Sólo se dibuja lo que cambió */
+        WidgetScreenRender(&screen);
     }
 }
 /*==================[external functions definition]==========================*/
@@ -167,20 +214,18 @@ void app_main(void){
 
     /* Configuración de display */
     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
-	ILI9341Rotate(ILI9341_Portrait_2);
+	ILI9341Rotate(ILI9341_Landscape_1);
 	ILI9341Fill(ILI9341_WHITE);
-    ILI9341DrawFilledRectangle(0, 0, 240, 40, LIGHT_BLUE_COLOR);
-    ILI9341DrawFilledRectangle(0, 280, 240, 320, LIGHT_BLUE_COLOR);
-    ILI9341DrawString(10, 290, "TIME10S", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-    ILI9341DrawString(178, 290, "00:04", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-    ILI9341DrawString(178, 120, "bpm", &font_22, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-    ILI9341DrawString(20, 60, "000", &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-    ILI9341DrawIcon(170, 8, ICON_BLUETOOTH, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-    ILI9341DrawIcon(200, 8, ICON_BAT_3, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    /* Panel de datos a la derecha: el área de la gráfica se desplaza completa */
+    ILI9341DrawFilledRectangle(PANEL_X, 0, 320, 40, LIGHT_BLUE_COLOR);
+    ILI9341DrawFilledRectangle(PANEL_X, 200, 320, 240, LIGHT_BLUE_COLOR);
+    ILI9341DrawString(PANEL_X + 8, 122, "bpm", &font_22, LIGHT_BLUE_COLOR, ILI9341_WHITE);
 
     /* Filtros */
     LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
     HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
+    /* Detector de latidos */
+    QrsDetectorInit(&qrs);
 
     /* Tarea para actualizar pantalla */
     xTaskCreate(&PlotTask, "Plot", 4096, NULL, 5, &plot_task_handle);
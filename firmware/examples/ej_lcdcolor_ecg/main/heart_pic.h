@@ -2,62 +2,68 @@
  * @file heart_pic.h
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  * @brief Picture of a heart
- * @note Created with http://www.digole.com/tools/PicturetoC_Hex_converter.php: "65K Color (2 bytes/pixel)"
- * @version 0.1
+ * @note Created with drivers/devices/tools/img_to_edu.py (palette + RLE, drawn with
+ * ILI9341DrawCompressedPicture()). Generated file, do not edit.
+ * @version 0.2
  * @date 2024-04-07
  * 
  * @copyright Copyright (c) 2024
  * 
  */
-#include <stdint.h>
+#ifndef HEART_H_
+#define HEART_H_
+#include "ili9341.h"
 
-#define HEART_WIDTH     52
-#define HEART_HEIGHT    45
+const uint16_t heart_palette[] = {
+	0xD000, 0xD020, 0xD021, 0xD041, 0xD061, 0xD062, 0xD082, 0xD0A2,
+	0xD0A3, 0xD0C3, 0xD0E3, 0xD124, 0xD145, 0xD165, 0xD185, 0xD1A6,
+	0xD1A7, 0xD1C7, 0xD966, 0xD9C7, 0xD9E7, 0xDA08, 0xDA28, 0xDA49,
+	0xDA69, 0xDA8A, 0xDACB, 0xDAEB, 0xDB0C, 0xDB2C, 0xDB4D, 0xDB8E,
+	0xE32C, 0xE34D, 0xE36D, 0xE38E, 0xE3AE, 0xE3AF, 0xE3CE, 0xE3CF,
+	0xE410, 0xE431, 0xE451, 0xE471, 0xE492, 0xE4B2, 0xECB2, 0xECD3,
+	0xECF3, 0xED14, 0xED55, 0xED75, 0xED76, 0xED96, 0xEDB6, 0xEDF7,
+	0xEE18, 0xF617, 0xF638, 0xF659, 0xF679, 0xF699, 0xF69A, 0xF6BA,
+	0xF6DB, 0xF6FB, 0xF6FC, 0xF71B, 0xF71C, 0xFF3C, 0xFF5C, 0xFF5D,
+	0xFF7D, 0xFF9D, 0xFF9E, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF,
+};
 
-const uint8_t heart[] = {
-    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xed,0x55,0xe3,0x6d,0xda,0x28,0xd9,0x66,0xd1,0x65,0xd9,0xc7,0xda,0xcb,0xe4,0x71,0xf6,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x1c,0xec,0xb2,0xdb,0x0c,0xd9,0xe7,0xd1,0x65,0xd1,0x65,0xda,0x08,0xe3,0x2c,0xed,0x14,0xff,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x1c,0xe3,0x4d,0xd0,0x61,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xf6,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xfb,0xda,0xcb,0xd0,0x20,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xda,0xcb,0xf6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xb2,0xd0,0x61,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x21,0xe4,0x31,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x14,0xd0,0x62,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xe3,0xcf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xdb,0x0c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xdb,0x0c,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x10,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xff,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0x2c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xdb,0x4d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x51,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x28,0xff,0xde,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xd3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0xb2,0xff,0xff,0xff,0xff,0xed,0xb6,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0xce,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0x3c,0xd0,0x82,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xf6,0xba,0xff,0x5d,0xd0,0xa3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xf6,0x79,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xe3,0xaf,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x28,0xdb,0x2c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x8a,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xdf,0xd0,0xa2,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xff,0x3c,0xff,0xff
-    ,0xff,0xff,0xee,0x18,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xec,0xf3,0xff,0xff
-    ,0xff,0xff,0xe4,0x51,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0x2c,0xff,0xff
-    ,0xff,0xff,0xe3,0x4d,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x28,0xff,0xff
-    ,0xff,0xff,0xda,0xcb,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0xa7,0xff,0xff
-    ,0xff,0xff,0xda,0xcb,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0xc7,0xff,0xff
-    ,0xff,0xff,0xe3,0x8e,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x69,0xff,0xff
-    ,0xff,0xff,0xec,0xb2,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0x8e,0xff,0xff
-    ,0xff,0xff,0xf6,0x79,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x55,0xff,0xff
-    ,0xff,0xff,0xff,0xdf,0xd0,0xc3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x20,0xff,0x5d,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xe3,0x6d,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xf6,0x99,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x75,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xda,0x49,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0x45,0xff,0xdf,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x79,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x75,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0x2c,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x08,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xd0,0xc3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xf6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x76,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0x71,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0x4d,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0x49,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xd1,0xa6,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0xe3,0xff,0x5c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xfc,0xd0,0xc3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xf6,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x38,0xd0,0x41,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xed,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x75,0xd0,0x20,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0x71,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xf3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x92,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xdb,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x92,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xd3,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe3,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x55,0xd0,0x41,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xe4,0x51,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0xf7,0xd0,0x82,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x41,0xed,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x9a,0xd1,0x24,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0xa2,0xf6,0x17,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xda,0x28,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0x85,0xf6,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xe3,0xae,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xda,0xeb,0xff,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x96,0xd0,0xa2,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x61,0xec,0xd3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xda,0x69,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0xc7,0xf6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0x14,0xd0,0xa2,0xd0,0x00,0xd0,0x00,0xd0,0x61,0xe4,0x51,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xe3,0x8e,0xda,0xeb,0xf7,0x1b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-    ,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-};
\ No newline at end of file
+const uint8_t heart_data[] = {
+	0xBC, 0x4E, 0x09, 0x49, 0x32, 0x22, 0x16, 0x12, 0x0D, 0x13, 0x1A, 0x2B, 0x40, 0x8D, 0x4E, 0x09,
+	0x44, 0x2E, 0x1C, 0x14, 0x0D, 0x0D, 0x15, 0x20, 0x31, 0x47, 0x8F, 0x4E, 0x02, 0x44, 0x21, 0x04,
+	0x88, 0x00, 0x01, 0x17, 0x3D, 0x89, 0x4E, 0x02, 0x41, 0x1A, 0x01, 0x87, 0x00, 0x02, 0x03, 0x1A,
+	0x3F, 0x8C, 0x4E, 0x01, 0x2E, 0x04, 0x8B, 0x00, 0x01, 0x02, 0x29, 0x87, 0x4E, 0x01, 0x31, 0x05,
+	0x8B, 0x00, 0x02, 0x01, 0x27, 0x4D, 0x88, 0x4E, 0x01, 0x4D, 0x1C, 0x8F, 0x00, 0x01, 0x1C, 0x4D,
+	0x84, 0x4E, 0x00, 0x28, 0x8F, 0x00, 0x01, 0x17, 0x4A, 0x87, 0x4E, 0x00, 0x1D, 0x91, 0x00, 0x00,
+	0x1E, 0x83, 0x4E, 0x00, 0x2A, 0x91, 0x00, 0x01, 0x16, 0x4C, 0x85, 0x4E, 0x00, 0x2F, 0x93, 0x00,
+	0x03, 0x2D, 0x4E, 0x4E, 0x36, 0x93, 0x00, 0x00, 0x26, 0x84, 0x4E, 0x01, 0x45, 0x06, 0x93, 0x00,
+	0x03, 0x03, 0x3F, 0x47, 0x08, 0x93, 0x00, 0x01, 0x01, 0x3C, 0x83, 0x4E, 0x00, 0x25, 0x95, 0x00,
+	0x01, 0x16, 0x1D, 0x95, 0x00, 0x00, 0x19, 0x82, 0x4E, 0x01, 0x4D, 0x07, 0xAD, 0x00, 0x04, 0x01,
+	0x45, 0x4E, 0x4E, 0x38, 0xAF, 0x00, 0x03, 0x30, 0x4E, 0x4E, 0x2A, 0xAF, 0x00, 0x03, 0x20, 0x4E,
+	0x4E, 0x21, 0xAF, 0x00, 0x03, 0x16, 0x4E, 0x4E, 0x1A, 0xAF, 0x00, 0x03, 0x10, 0x4E, 0x4E, 0x1A,
+	0xAF, 0x00, 0x03, 0x11, 0x4E, 0x4E, 0x23, 0xAF, 0x00, 0x03, 0x18, 0x4E, 0x4E, 0x2E, 0xAF, 0x00,
+	0x03, 0x23, 0x4E, 0x4E, 0x3C, 0xAF, 0x00, 0x04, 0x32, 0x4E, 0x4E, 0x4D, 0x09, 0xAD, 0x00, 0x01,
+	0x01, 0x47, 0x82, 0x4E, 0x00, 0x22, 0xAD, 0x00, 0x00, 0x17, 0x83, 0x4E, 0x00, 0x3D, 0xAD, 0x00,
+	0x00, 0x33, 0x84, 0x4E, 0x00, 0x17, 0xAB, 0x00, 0x01, 0x0C, 0x4D, 0x84, 0x4E, 0x00, 0x3C, 0xAB,
+	0x00, 0x00, 0x33, 0x86, 0x4E, 0x00, 0x1D, 0xA9, 0x00, 0x00, 0x15, 0x87, 0x4E, 0x01, 0x47, 0x09,
+	0xA7, 0x00, 0x01, 0x03, 0x3F, 0x88, 0x4E, 0x00, 0x34, 0xA7, 0x00, 0x00, 0x2B, 0x8A, 0x4E, 0x00,
+	0x1E, 0xA5, 0x00, 0x01, 0x17, 0x4D, 0x8A, 0x4E, 0x01, 0x4B, 0x0F, 0xA3, 0x00, 0x01, 0x0A, 0x46,
+	0x8C, 0x4E, 0x01, 0x42, 0x09, 0xA1, 0x00, 0x01, 0x03, 0x3B, 0x8E, 0x4E, 0x01, 0x3A, 0x03, 0xA0,
+	0x00, 0x00, 0x32, 0x90, 0x4E, 0x01, 0x33, 0x01, 0x9E, 0x00, 0x00, 0x2B, 0x92, 0x4E, 0x00, 0x30,
+	0x9D, 0x00, 0x00, 0x27, 0x94, 0x4E, 0x00, 0x2C, 0x9B, 0x00, 0x00, 0x1F, 0x96, 0x4E, 0x00, 0x2C,
+	0x99, 0x00, 0x00, 0x23, 0x98, 0x4E, 0x00, 0x2F, 0x97, 0x00, 0x00, 0x27, 0x9A, 0x4E, 0x01, 0x32,
+	0x03, 0x94, 0x00, 0x00, 0x2A, 0x9C, 0x4E, 0x01, 0x37, 0x06, 0x91, 0x00, 0x01, 0x03, 0x31, 0x9E,
+	0x4E, 0x01, 0x3E, 0x0B, 0x8F, 0x00, 0x01, 0x07, 0x39, 0xA0, 0x4E, 0x01, 0x47, 0x16, 0x8D, 0x00,
+	0x01, 0x0E, 0x41, 0xA2, 0x4E, 0x01, 0x4D, 0x24, 0x8B, 0x00, 0x01, 0x1B, 0x4A, 0xA5, 0x4E, 0x01,
+	0x35, 0x07, 0x87, 0x00, 0x01, 0x04, 0x2F, 0xA8, 0x4E, 0x01, 0x45, 0x18, 0x85, 0x00, 0x01, 0x11,
+	0x3F, 0xAB, 0x4E, 0x06, 0x31, 0x07, 0x00, 0x00, 0x04, 0x2A, 0x4D, 0xAD, 0x4E, 0x03, 0x48, 0x23,
+	0x1B, 0x43, 0xCB, 0x4E,
+};
+
+const ili9341_picture_t heart = {
+	52,
+	45,
+	heart_palette,
+	heart_data
+};
+
+#endif /* HEART_H_ */
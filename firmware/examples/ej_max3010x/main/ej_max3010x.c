@@ -12,12 +12,23 @@
  * | 	3V3		 	| 	3V3			|
  * | 	SCL		 	| 	SCL 		|
  * | 	GND		 	| 	GND			|
+ *
+ * Con MOTION_CANCEL en 1, los artefactos de movimiento se cancelan usando como referencia la
+ * aceleración medida por un MPU6050 montado junto al sensor (en el mismo bus I2C):
+ *
+ * |   	MPU6050		|   ESP-EDU		|
+ * |:--------------:|:--------------|
+ * | 	SDA     	|	SDA 		|
+ * | 	VCC		 	| 	3V3			|
+ * | 	SCL		 	| 	SCL 		|
+ * | 	GND		 	| 	GND			|
  * 
  * @section changelog Changelog
  *
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 21/05/2024 | Document creation		                         |
+ * | 19/10/2026 | Cancelación de artefactos de movimiento (NLMS) |
  *
  * @author Juan Ignacio Cerrudo (juan.cerrudo@uner.edu.ar)
  *
@@ -33,10 +44,14 @@
 #include <max3010x.h>
 #include "spo2_algorithm.h"
 #include "led.h"
+#include "mpu6050.h"
+#include "nlms_filter.h"
 /*==================[macros and definitions]=================================*/
 #define BUFFER_SIZE 256
 #define SAMPLE_FREQ	100
 #define CONFIG_BLINK_PERIOD 100
+#define MOTION_CANCEL 1		/* 0 si no se conecta el MPU6050 */
+#define NEW_SAMPLES 25
 /*==================[internal data definition]===============================*/
 float dato_filt;
 float dato;
@@ -48,6 +63,12 @@ int32_t spo2; //SPO2 value
 int8_t validSPO2; //indicator to show if the SPO2 calculation is valid
 int32_t heartRate; //heart rate value
 int8_t validHeartRate; //indicator to show if the heart rate calculation is valid
+#if MOTION_CANCEL
+/* Cancelador NLMS: referencias = ejes del acelerómetro, canales = rojo e IR */
+nlms_filter_t motion = {.sample_freq = SAMPLE_FREQ, .n_refs = 3, .n_channels = 2, .taps = 4, .mu = 0.01};
+float acc[NEW_SAMPLES * 3];
+float ppg[NEW_SAMPLES * 2];
+#endif
 /*==================[internal functions declaration]=========================*/
 
 /*==================[external functions definition]==========================*/
@@ -57,6 +78,10 @@ void app_main(void){
     LedsInit();
     MAX3010X_begin();
 	MAX3010X_setup( 30, 1 , 2, SAMPLE_FREQ, 69, 4096);
+#if MOTION_CANCEL
+    MPU6050_initialize();
+    NlmsFilterInit(&motion);
+#endif
     /* Se imprimen por consola los valores de frequencia y magnitud correspondiente */
     printf("****MAX30102 Test****\n");
 
@@ -77,6 +102,15 @@ void app_main(void){
 		    redBuffer[i] = MAX3010X_getRed();
 		    irBuffer[i] = MAX3010X_getIR();
 		    MAX3010X_nextSample(); //We're finished with this sample so move to next sample
+#if MOTION_CANCEL
+            int16_t ax, ay, az;
+            MPU6050_getAcceleration(&ax, &ay, &az);
+            acc[(i - 75) * 3] = ax;
+            acc[(i - 75) * 3 + 1] = ay;
+            acc[(i - 75) * 3 + 2] = az;
+            ppg[(i - 75) * 2] = redBuffer[i];
+            ppg[(i - 75) * 2 + 1] = irBuffer[i];
+#endif
 		            
             //send samples and calculation result to terminal program through UART
 	     	dato = (float)redBuffer[i];
@@ -85,6 +119,15 @@ void app_main(void){
              
 	}
 
+#if MOTION_CANCEL
+    /* Se quita de las 25 muestras nuevas la parte correlacionada con el movimiento */
+    NlmsFilterProcess(&motion, acc, ppg, ppg, NEW_SAMPLES);
+    for (i = 75; i < 100; i++)
+    {
+        redBuffer[i] = (ppg[(i - 75) * 2] > 0) ? ppg[(i - 75) * 2] : 0;
+        irBuffer[i] = (ppg[(i - 75) * 2 + 1] > 0) ? ppg[(i - 75) * 2 + 1] : 0;
+    }
+#endif
 	//After gathering 25 new samples recalculate HR and SP02
 	maxim_heart_rate_and_oxygen_saturation(irBuffer, bufferLength, redBuffer, &spo2, &validSPO2, &heartRate, &validHeartRate);
     printf("HR= %ld, HRvalid= %d \n", heartRate, validHeartRate);
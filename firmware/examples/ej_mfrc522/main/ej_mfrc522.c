@@ -14,6 +14,7 @@
  * | 	SDI/MOSI 	| 	GPIO_21		|
  * | 	RESET	 	| 	GPIO_18		|
  * | 	CS		 	| 	GPIO_9		|
+ * | 	IRQ		 	| 	GPIO_3		|
  * | 	GND		 	| 	GND			|
  *
  * @section changelog Changelog
@@ -21,6 +22,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 17/05/2024 | Document creation		                         |
+ * | 19/10/2026 | Card events from the RFID service              |
  *
  * @author Juan Ignacio Cerrudo (juan.cerrudo@uner.edu.ar)
  *
@@ -35,8 +37,12 @@
 #include "led.h"
 #include "uart_mcu.h"
 #include "rfid_utils.h"
+#include "rfid_service.h"
 /*==================[macros and definitions]=================================*/
 #define CONFIG_BLINK_PERIOD 1000
+#define RFID_IRQ_PIN        GPIO_3
+#define RFID_IDLE_PERIOD    100
+#define RFID_SCAN_PERIOD    200
 /*==================[internal data definition]===============================*/
 unsigned int last_user_ID;
 // RFID structs
@@ -45,22 +51,22 @@ MFRC522Ptr_t mfrcInstance;
 /**
  * Executed every time the card reader detects a user in
  */
-void userTapIn() {
+void userTapIn(Uid *uid) {
 
 //	show card UID
 	UartSendString(UART_PC,"\nCard uid bytes: ");
-	for (uint8_t i = 0; i < mfrcInstance->uid.size; i++) {
+	for (uint8_t i = 0; i < uid->size; i++) {
 		UartSendString(UART_PC," 0X");
-		UartSendString(UART_PC, (char*)UartItoa(mfrcInstance->uid.uidByte[i], 16));
+		UartSendString(UART_PC, (char*)UartItoa(uid->uidByte[i], 16));
 		UartSendString(UART_PC," ");
 	}
 	UartSendString(UART_PC,"\n\r");
 	// Convert the uid bytes to an integer, byte[0] is the MSB
 	last_user_ID =
-		(int)mfrcInstance->uid.uidByte[3] |
-		(int)mfrcInstance->uid.uidByte[2] << 8 |
-		(int)mfrcInstance->uid.uidByte[1] << 16 |
-		(int)mfrcInstance->uid.uidByte[0] << 24;
+		(int)uid->uidByte[3] |
+		(int)uid->uidByte[2] << 8 |
+		(int)uid->uidByte[1] << 16 |
+		(int)uid->uidByte[0] << 24;
 
 	UartSendString(UART_PC,"Card Read user ID: ");
 	UartSendString(UART_PC, (char*)UartItoa(last_user_ID, 10));
@@ -68,6 +74,22 @@ void userTapIn() {
 
 
 }
+
+/**
+ * Executed by the RFID service when a card enters or leaves the field
+ */
+void cardEvent(rfid_event_t event, Uid *uid, void *param) {
+	if (event == RFID_CARD_ARRIVED) {
+		LedOn(LED_1);
+		userTapIn(uid);
+	} else {
+		Uid cards[RFID_MAX_CARDS];
+		UartSendString(UART_PC,"Card left\r\n");
+		if (RfidServiceGetCards(cards, RFID_MAX_CARDS) == 0) {
+			LedOff(LED_1);
+		}
+	}
+}
 /*==================[external functions definition]==========================*/
 void app_main(void){
 	
@@ -79,16 +101,19 @@ void app_main(void){
 	setupRFID(&mfrcInstance);
 
 	UartSendString(UART_PC,"Init MRFC522 test.\r\n");
-	
+
+	rfid_service_config_t rfid = {
+		.mfrc = mfrcInstance,
+		.irq = RFID_IRQ_PIN,
+		.idle_period = RFID_IDLE_PERIOD,
+		.scan_period = RFID_SCAN_PERIOD,
+		.func_p = cardEvent,
+		.param_p = NULL
+	};
+	RfidServiceInit(&rfid);
+
     while(true){
-		UartSendString(UART_PC,"Reading... \r\n");
-		if (PICC_IsNewCardPresent(mfrcInstance)) {
-			if (PICC_ReadCardSerial(mfrcInstance)) {
-				LedOn(LED_1);
-				userTapIn();
-				LedOff(LED_1);
-			}
-		}
+		LedToggle(LED_3);
 		vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
 	}
 }
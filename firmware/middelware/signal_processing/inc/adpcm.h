@@ -0,0 +1,71 @@
+#ifndef ADPCM_H_
+#define ADPCM_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup ADPCM IMA-ADPCM decoder
+ */
+
+/** \brief Streaming decoder for IMA-ADPCM compressed audio
+ *
+ * Each 16 bits sample is stored as a 4 bits code (two samples per byte, first sample in the
+ * low nibble), so a clip takes half the flash of 8 bits PCM with 16 bits quality. Decoding
+ * takes a few additions and two table lookups per sample.
+ *
+ * The stream has no headers: it starts with predictor = 0 and step index = 0, as the encoder
+ * in wav_to_edu.py does. To play it again from the beginning, call AdpcmInit() again.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief IMA-ADPCM stream
+ */
+typedef struct {
+    const uint8_t *data;    /*!< Encoded stream (n_samples / 2 bytes, rounded up) */
+    uint32_t n_samples;     /*!< Samples in the stream */
+    uint32_t pos;           /*!< Next sample to decode */
+    int16_t predictor;      /*!< Last decoded sample */
+    uint8_t index;          /*!< Step index (0 to 88) */
+} adpcm_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a stream to decode it from its first sample
+ * 
+ * @param adpcm         Stream
+ * @param data          Encoded data
+ * @param n_samples     Samples in the stream
+ */
+void AdpcmInit(adpcm_t *adpcm, const uint8_t *data, uint32_t n_samples);
+
+/**
+ * @brief Decodes the next samples of a stream
+ * 
+ * @param adpcm         Stream
+ * @param out           Array to store decoded samples (of lenght = samples)
+ * @param samples       Samples to decode
+ * @return uint16_t     Samples decoded (less than samples at the end of the stream)
+ */
+uint16_t AdpcmDecode(adpcm_t *adpcm, int16_t *out, uint16_t samples);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ADPCM_H_ */
+
+/*==================[end of file]============================================*/
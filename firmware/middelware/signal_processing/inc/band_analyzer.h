@@ -0,0 +1,100 @@
+#ifndef BAND_ANALYZER_H_
+#define BAND_ANALYZER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Band_Analyzer Band analyzer
+ */
+
+/** \brief Groups a power spectrum in log or mel spaced bands, to be shown as bars (VU meter)
+ * 
+ * The bin to band map is calculated once in BandAnalyzerInit(): each band sums whole bins,
+ * with fractional weights only for the two bins at its edges, and a precomputed scale turns
+ * the sum into the mean power of the band. So each frame costs one addition per bin, plus a
+ * logarithm, smoothing and quantization per band.
+ * 
+ * Band levels (in dB) rise with the attack coefficient and fall at most decay dB per frame,
+ * peaks are held for peak_hold frames and then fall peak_decay dB per frame.
+ * 
+ * Usage:
+ * @code
+ * FFTPower(signal, power, N);
+ * BandAnalyzerUpdate(&analyzer, power, bars, peaks);
+ * @endcode
+ * 
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define BANDS_MAX   32      /*!< Maximum number of bands */
+/*==================[typedef]================================================*/
+/**
+ * @brief Band spacing
+ */
+typedef enum band_scale {
+    BAND_SCALE_LOG,         /*!< Same width in octaves for every band */
+    BAND_SCALE_MEL          /*!< Same width in mels for every band */
+} band_scale_t;
+
+/**
+ * @brief Band analyzer
+ */
+typedef struct {
+    uint8_t n_bands;            /*!< Number of bands (BANDS_MAX max) */
+    band_scale_t scale;         /*!< Band spacing */
+    float sample_freq;          /*!< Signal's sample frequency */
+    uint16_t signal_lenght;     /*!< Lenght of the FFT input (power spectrum has signal_lenght / 2 bins) */
+    float f_min;                /*!< Lower edge of first band (Hz) */
+    float f_max;                /*!< Upper edge of last band (Hz), sample_freq / 2 max */
+    float floor_db;             /*!< Band power shown as an empty bar (dB) */
+    float range_db;             /*!< Band power range from empty to full bar (dB) */
+    float attack;               /*!< Fraction of a level rise applied per frame (0 to 1, 1: instant) */
+    float decay;                /*!< Maximum level fall per frame (dB) */
+    uint8_t peak_hold;          /*!< Frames a peak is held */
+    float peak_decay;           /*!< Peak fall per frame after being held (dB) */
+    /* internal */
+    uint16_t first[BANDS_MAX];  /*!< First bin of each band */
+    uint16_t last[BANDS_MAX];   /*!< Last bin of each band */
+    float w_first[BANDS_MAX];   /*!< Weight of the first bin */
+    float w_last[BANDS_MAX];    /*!< Weight of the last bin */
+    float band_scale[BANDS_MAX];/*!< 1 / band width in bins */
+    float level[BANDS_MAX];     /*!< Smoothed level (dB) */
+    float peak[BANDS_MAX];      /*!< Peak level (dB) */
+    uint8_t hold[BANDS_MAX];    /*!< Frames left for each peak */
+} band_analyzer_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Calculates the bin to band map and clears levels and peaks
+ * 
+ * @param analyzer      Band analyzer with its configuration
+ */
+void BandAnalyzerInit(band_analyzer_t *analyzer);
+
+/**
+ * @brief Updates band levels and peaks with a new power spectrum
+ * 
+ * @param analyzer      Band analyzer
+ * @param power         Power spectrum (of lenght = signal_lenght / 2), as returned by FFTPower()
+ * @param bars          Array to store bar heights, 0 to 255 (of lenght = n_bands)
+ * @param peaks         Array to store peak heights, 0 to 255 (of lenght = n_bands), or NULL
+ */
+void BandAnalyzerUpdate(band_analyzer_t *analyzer, const float *power, uint8_t *bars, uint8_t *peaks);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BAND_ANALYZER_H_ */
+
+/*==================[end of file]============================================*/
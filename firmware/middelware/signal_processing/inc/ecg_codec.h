@@ -0,0 +1,116 @@
+#ifndef ECG_CODEC_H_
+#define ECG_CODEC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup ECG_Codec ECG Codec
+ */
+
+/** \brief ECG compression, to send or store less bytes (BLE, flash)
+ *
+ * Samples (int16_t, ex: ADC values) are encoded in blocks of block_lenght samples, each one in
+ * a packet that can be decoded by itself (a lost packet doesn't affect the next ones):
+ *
+ * - ECG_CODEC_LOSSLESS: fixed prediction (0, x[n-1] or 2 x[n-1] - x[n-2]) and Rice coding of
+ *   the prediction error, with the predictor and Rice parameter that give the fewest bits in
+ *   each block. Decoded samples are exactly the original ones.
+ * - ECG_CODEC_DCT: DCT (dsps_dct_f32) of each block and uniform quantization of its coefficients,
+ *   Rice coded. The quantization step of each block is the largest one that keeps the PRD
+ *   (percentage RMS difference, mean removed) under prd. Needs FFTInit() (FFT tables) and
+ *   block_lenght a power of two.
+ *
+ * Packet format (bits, MSB first): 
+ * | mode (1) | samples - 1 (7) | predictor order (3) | Rice parameter (5) | LOSSLESS: first
+ * sample (16), n - 1 Rice coded prediction errors | DCT: step (8), last coefficient (8), DC (24), Rice coded
+ * coefficients 1 to last | padding up to a whole byte.
+ *
+ * EcgCodecDecode() doesn't depend on the ESP32 (DCT mode needs esp-dsp, ANSI C): it can be
+ * compiled in the receiving PC.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define ECG_CODEC_BLOCK_MAX     64      /*!< Maximum samples per block */
+
+/**
+ * @brief Maximum bytes given by EcgCodecEncode() or EcgCodecFlush() for n samples
+ */
+#define ECG_CODEC_OUT_MAX(n)    ((((n) / ECG_CODEC_BLOCK_MAX) + 2) * (ECG_CODEC_BLOCK_MAX * 5 + 8))
+/*==================[typedef]================================================*/
+/**
+ * @brief Codec modes
+ */
+typedef enum {
+    ECG_CODEC_LOSSLESS = 0,             /*!< Prediction + Rice coding */
+    ECG_CODEC_DCT,                      /*!< DCT + quantization with bounded error */
+} ecg_codec_mode_t;
+
+/**
+ * @brief ECG encoder
+ */
+typedef struct {
+    ecg_codec_mode_t mode;              /*!< Codec mode */
+    uint8_t block_lenght;               /*!< Samples per packet (up to ECG_CODEC_BLOCK_MAX, ex: 64) */
+    float prd;                          /*!< DCT mode: maximum PRD of each block (%, ex: 1) */
+    /* internal */
+    int16_t block[ECG_CODEC_BLOCK_MAX]; /*!< Samples waiting to be encoded */
+    uint8_t count;                      /*!< Samples in block */
+} ecg_codec_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an ECG encoder
+ *
+ * @param codec         ECG encoder with its configuration
+ */
+void EcgCodecInit(ecg_codec_t *codec);
+
+/**
+ * @brief Encodes a block of samples (of any lenght), a packet is given every block_lenght samples
+ *
+ * @param codec         ECG encoder
+ * @param signal        Samples
+ * @param signal_lenght Number of samples
+ * @param data          Array to store the packets (of lenght = ECG_CODEC_OUT_MAX(signal_lenght))
+ * @return uint16_t     Bytes stored in data
+ */
+uint16_t EcgCodecEncode(ecg_codec_t *codec, const int16_t *signal, uint16_t signal_lenght, uint8_t *data);
+
+/**
+ * @brief Encodes the samples waiting for a complete block (lossless packet)
+ *
+ * @param codec         ECG encoder
+ * @param data          Array to store the packet (of lenght = ECG_CODEC_OUT_MAX(0))
+ * @return uint16_t     Bytes stored in data
+ */
+uint16_t EcgCodecFlush(ecg_codec_t *codec, uint8_t *data);
+
+/**
+ * @brief Decodes the first packet of data
+ *
+ * @param data          Received bytes
+ * @param size          Number of bytes received
+ * @param signal        Array to store decoded samples (of lenght = ECG_CODEC_BLOCK_MAX)
+ * @param signal_lenght Number of samples decoded
+ * @return uint16_t     Bytes of the packet (0 if it is incomplete or not valid)
+ */
+uint16_t EcgCodecDecode(const uint8_t *data, uint16_t size, int16_t *signal, uint16_t *signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ECG_CODEC_H_ */
+
+/*==================[end of file]============================================*/
@@ -8,6 +8,13 @@
  */
 
 /** \brief Functionalities to calculate FFT
+ *
+ * Also a Goertzel filter bank, for when only a few frequencies are needed (mains hum, DTMF,
+ * a known stimulus): each bin costs one multiplication and two additions per sample, instead
+ * of a full FFT of the block.
+ *
+ * And a Welch power spectral density estimator: overlapping Hann windowed segments of a
+ * stream are averaged as they complete, keeping only one segment and one spectrum in memory.
  * 
  * @author Peñalva Albano
  *
@@ -16,6 +23,9 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 19/10/2026 | Power spectrum (FFTPower)                      						|
+ * | 19/10/2026 | Goertzel filter bank                           						|
+ * | 19/10/2026 | Welch PSD estimator, Hann window cached        						|
  * 
  **/
 
@@ -24,7 +34,42 @@
 #include <stdbool.h>
 /*==================[macros]=================================================*/
 #define MAX_SIGNAL_LENGHT   2048
+#define GOERTZEL_BINS_MAX   16      /*!< Maximum frequencies of a Goertzel bank */
+#define WELCH_LENGHT_MAX    1024    /*!< Maximum segment lenght of a Welch estimator */
 /*==================[typedef]================================================*/
+/**
+ * @brief Goertzel filter bank
+ */
+typedef struct {
+    float sample_freq;                  /*!< Signal's sample frequency */
+    uint16_t block_lenght;              /*!< Samples per block (resolution = sample_freq / block_lenght) */
+    uint8_t n_bins;                     /*!< Number of frequencies */
+    float freq[GOERTZEL_BINS_MAX];      /*!< Frequencies (Hz), not necessarily multiples of the resolution */
+    /* internal */
+    float coeff[GOERTZEL_BINS_MAX];     /*!< 2 cos(w) of each bin */
+    float sin_w[GOERTZEL_BINS_MAX];     /*!< sin(w) of each bin */
+    float cos_end[GOERTZEL_BINS_MAX];   /*!< cos(w (block_lenght - 1)): phase referred to block start */
+    float sin_end[GOERTZEL_BINS_MAX];   /*!< sin(w (block_lenght - 1)) */
+    float scale[GOERTZEL_BINS_MAX];     /*!< Magnitude scale of each bin */
+    float s1[GOERTZEL_BINS_MAX];        /*!< Filter state: last output */
+    float s2[GOERTZEL_BINS_MAX];        /*!< Filter state: previous output */
+    uint16_t count;                     /*!< Samples of current block */
+} goertzel_t;
+
+/**
+ * @brief Welch PSD estimator
+ */
+typedef struct {
+    float sample_freq;                  /*!< Signal's sample frequency */
+    uint16_t segment_lenght;            /*!< Samples per segment, power of two (resolution = sample_freq / segment_lenght) */
+    uint16_t overlap;                   /*!< Samples shared by consecutive segments (usually segment_lenght / 2) */
+    /* internal */
+    float segment[WELCH_LENGHT_MAX];    /*!< Samples of current segment */
+    float psd_sum[WELCH_LENGHT_MAX/2];  /*!< Sum of the PSD of every segment */
+    uint16_t count;                     /*!< Samples in segment */
+    uint32_t n_segments;                /*!< Segments averaged */
+    float scale;                        /*!< FFT power to PSD (window power correction) */
+} welch_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -48,6 +93,17 @@ bool FFTInit(void);
  */
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
 
+/**
+ * @brief Calculates the power spectrum of a given signal (FFTMagnitude squared, without square roots)
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * 
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param power             Array to store power values (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal arrays
+ */
+void FFTPower(float * signal, float * power, uint16_t signal_lenght);
+
 /**
  * @brief Return the FFT frequency axis vector
  * 
@@ -57,6 +113,66 @@ void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
  */
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f);
 
+/**
+ * @brief Initialize a Goertzel filter bank (coefficients of each frequency)
+ * 
+ * @param goertzel          Goertzel filter bank with its configuration
+ */
+void GoertzelInit(goertzel_t * goertzel);
+
+/**
+ * @brief Processes a block of samples (of any lenght) through a Goertzel filter bank
+ * 
+ * Results are given every block_lenght samples, with the same scale as FFTMagnitude (amplitude
+ * of a sine at each frequency). If more than one block ends in the same call, results are from
+ * the last one.
+ * 
+ * @param goertzel          Goertzel filter bank
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param signal_lenght     Lenght of signal array
+ * @param magnitude         Array to store magnitude of each frequency (of lenght = n_bins)
+ * @param phase             Array to store phase (rad, cosine referred to block start) of each 
+ *                          frequency (of lenght = n_bins), or NULL
+ * @return true             A block ended: magnitude (and phase) updated
+ * @return false            No block ended
+ */
+bool GoertzelProcess(goertzel_t * goertzel, const float * signal, uint16_t signal_lenght, float * magnitude, float * phase);
+
+/**
+ * @brief Initialize (empty) a Welch PSD estimator
+ * 
+ * @note  FFTInit must be called first
+ * 
+ * @param welch             Welch estimator with its configuration
+ */
+void WelchInit(welch_t * welch);
+
+/**
+ * @brief Processes a block of samples (of any lenght), each segment completed is added to the average
+ * 
+ * @note  Each segment takes a FFT of segment_lenght points
+ * 
+ * @param welch             Welch estimator
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param signal_lenght     Lenght of signal array
+ * @return uint16_t         Number of segments completed
+ */
+uint16_t WelchProcess(welch_t * welch, const float * signal, uint16_t signal_lenght);
+
+/**
+ * @brief Averaged one-sided power spectral density
+ * 
+ * The sum of psd values times the resolution (sample_freq / segment_lenght) is the signal 
+ * power: a sine of amplitude A adds A^2 / 2, around its frequency.
+ * 
+ * @param welch             Welch estimator
+ * @param psd               Array to store PSD values (units^2 / Hz, of lenght = segment_lenght / 2),
+ *                          frequencies are given by FFTFrequency
+ * @return true             PSD calculated
+ * @return false            No segment completed yet
+ */
+bool WelchPSD(welch_t * welch, float * psd);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
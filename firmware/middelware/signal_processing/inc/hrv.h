@@ -0,0 +1,127 @@
+#ifndef HRV_H_
+#define HRV_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup HRV Heart rate variability
+ */
+
+/** \brief Heart rate variability metrics over a sliding window of RR intervals
+ *
+ * RR intervals (ms) can come from QrsDetectorProcess(), checkForBeat() or any other beat
+ * detector. The window keeps the beats of the last window_ms milliseconds.
+ *
+ * - Time domain (mean RR, SDNN, RMSSD, pNN50): integer running sums, updated when a beat enters
+ *   or leaves the window, so HrvAddRR() and HrvTimeDomain() take a constant time.
+ * - Frequency domain (LF 0.04-0.15 Hz, HF 0.15-0.4 Hz, LF/HF): Lomb-Scargle periodogram of the
+ *   RR series, which doesn't need evenly spaced samples. It takes one sine and cosine per beat
+ *   (frequencies are obtained by rotation), so it can be called on a coarse schedule
+ *   (ex: every 30 s) alongside other tasks.
+ *
+ * RR intervals out of HRV_RR_MIN to HRV_RR_MAX are discarded (artifacts, missed beats), and
+ * the successive difference with the next beat is not used.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * | 19/10/2026 | Window lenght clamped, 5 min windows at any valid heart rate			|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define HRV_BEATS_MAX       1024    /*!< Maximum beats in the window (5 min of RR intervals down to HRV_RR_MIN) */
+#define HRV_RR_MIN          300     /*!< Shortest valid RR interval (ms) */
+#define HRV_RR_MAX          2000    /*!< Longest valid RR interval (ms) */
+#define HRV_WINDOW_MIN      60000   /*!< Shortest window (ms) */
+#define HRV_WINDOW_MAX      300000  /*!< Longest window (ms) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Time domain metrics
+ */
+typedef struct {
+    float mean_rr;          /*!< Mean RR interval (ms) */
+    float sdnn;             /*!< Standard deviation of RR intervals (ms) */
+    float rmssd;            /*!< Root mean square of successive differences (ms) */
+    float pnn50;            /*!< Successive differences greater than 50 ms (%) */
+} hrv_time_t;
+
+/**
+ * @brief Frequency domain metrics
+ */
+typedef struct {
+    float lf;               /*!< Low frequency power, 0.04 to 0.15 Hz (ms^2) */
+    float hf;               /*!< High frequency power, 0.15 to 0.4 Hz (ms^2) */
+    float lf_hf;            /*!< LF / HF ratio */
+} hrv_freq_t;
+
+/**
+ * @brief HRV window
+ */
+typedef struct {
+    uint32_t window_ms;             /*!< Window lenght (ms), HRV_WINDOW_MIN to HRV_WINDOW_MAX */
+    /* internal */
+    uint16_t rr[HRV_BEATS_MAX];     /*!< RR intervals (ms) */
+    int16_t diff[HRV_BEATS_MAX];    /*!< Difference with previous RR interval (marked when not valid) */
+    uint16_t first;                 /*!< Oldest beat */
+    uint16_t n;                     /*!< Beats in the window */
+    uint32_t sum_rr;                /*!< Sum of RR intervals (ms) */
+    uint64_t sum_rr2;               /*!< Sum of squared RR intervals */
+    uint64_t sum_diff2;             /*!< Sum of squared successive differences */
+    uint16_t n_diff;                /*!< Valid successive differences */
+    uint16_t nn50;                  /*!< Successive differences greater than 50 ms */
+    bool gap;                       /*!< Last RR interval was discarded */
+} hrv_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize (empty) a HRV window
+ *
+ * window_ms out of HRV_WINDOW_MIN to HRV_WINDOW_MAX is clamped to that range.
+ *
+ * @param hrv           HRV window with its configuration
+ */
+void HrvInit(hrv_t *hrv);
+
+/**
+ * @brief Adds a RR interval, beats older than window_ms leave the window
+ *
+ * @param hrv           HRV window
+ * @param rr_ms         RR interval (ms)
+ */
+void HrvAddRR(hrv_t *hrv, uint16_t rr_ms);
+
+/**
+ * @brief Time domain metrics of the window
+ *
+ * @param hrv           HRV window
+ * @param metrics       Time domain metrics
+ * @return true         Metrics calculated
+ * @return false        Not enough beats (at least 3 are needed)
+ */
+bool HrvTimeDomain(hrv_t *hrv, hrv_time_t *metrics);
+
+/**
+ * @brief Frequency domain metrics of the window (Lomb-Scargle periodogram)
+ *
+ * @param hrv           HRV window
+ * @param metrics       Frequency domain metrics
+ * @return true         Metrics calculated
+ * @return false        Window too short (at least 50 s are needed to resolve 0.04 Hz)
+ */
+bool HrvFreqDomain(hrv_t *hrv, hrv_freq_t *metrics);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* HRV_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,84 @@
+#ifndef NLMS_FILTER_H_
+#define NLMS_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup NLMS_Filter NLMS Filter
+ */
+
+/** \brief Normalized LMS adaptive noise canceller (ex: motion artifacts of PPG signals)
+ *
+ * Each channel (ex: red and IR PPG) has the part correlated with the reference signals (ex: the
+ * three axes of an accelerometer, sampled with the channels) removed. An adaptive FIR filter of
+ * taps coefficients per reference estimates that part, and its coefficients are updated every
+ * sample with the normalized LMS rule: w += mu * e * u / |u|^2.
+ *
+ * DC is removed from references and channels (0.5 Hz high pass) before adapting, and output
+ * keeps the channel DC, so it can replace the raw samples (ex: SpO2 calculation, that needs
+ * AC / DC ratios). Movements slower than 0.5 Hz are left as baseline wander. Dot products use dsps_dotprod_f32 and all the state has a fixed size:
+ * a sample costs about (2 * n_channels + 1) * n_refs * taps multiplications.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define NLMS_REFS_MAX       3       /*!< Maximum reference signals */
+#define NLMS_CHANNELS_MAX   2       /*!< Maximum channels cleaned */
+#define NLMS_TAPS_MAX       16      /*!< Maximum taps per reference */
+/*==================[typedef]================================================*/
+/**
+ * @brief NLMS adaptive noise canceller
+ */
+typedef struct {
+    float sample_freq;              /*!< Signals' sample frequency */
+    uint8_t n_refs;                 /*!< Number of reference signals (1 to NLMS_REFS_MAX) */
+    uint8_t n_channels;             /*!< Number of channels (1 to NLMS_CHANNELS_MAX) */
+    uint8_t taps;                   /*!< Taps per reference (1 to NLMS_TAPS_MAX, ex: 4 at 100 Hz) */
+    float mu;                       /*!< Step size, 0 to 1 (ex: 0.01): higher adapts faster but removes less */
+    /* internal */
+    float weights[NLMS_CHANNELS_MAX][NLMS_REFS_MAX * NLMS_TAPS_MAX];    /*!< Coefficients of each channel */
+    float history[NLMS_REFS_MAX][2 * NLMS_TAPS_MAX];    /*!< Last taps references (written twice) */
+    uint8_t pos;                    /*!< Position in history */
+    float dc_pole;                  /*!< DC removal filter pole */
+    float ref_prev[NLMS_REFS_MAX];  /*!< DC removal: last reference samples */
+    float ref_ac[NLMS_REFS_MAX];    /*!< DC removal: last reference outputs */
+    float ch_prev[NLMS_CHANNELS_MAX];   /*!< DC removal: last channel samples */
+    float ch_ac[NLMS_CHANNELS_MAX];     /*!< DC removal: last channel outputs */
+} nlms_filter_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a NLMS filter (coefficients to zero)
+ *
+ * @param filter        NLMS filter with its configuration
+ */
+void NlmsFilterInit(nlms_filter_t *filter);
+
+/**
+ * @brief Cleans a block of samples
+ *
+ * @param filter        NLMS filter
+ * @param reference     Reference samples, n_refs per sample (ex: x0 y0 z0 x1 y1 z1 ...)
+ * @param input         Channels samples, n_channels per sample (ex: red0 ir0 red1 ir1 ...)
+ * @param output        Array to store cleaned channels samples (same layout as input, can be input)
+ * @param signal_lenght Number of samples (of each signal)
+ */
+void NlmsFilterProcess(nlms_filter_t *filter, const float *reference, const float *input, float *output, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* NLMS_FILTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,113 @@
+#ifndef QRS_DETECTOR_H_
+#define QRS_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup QRS_Detector QRS Detector
+ */
+
+/** \brief Streaming QRS (heart beat) detector for ECG signals, based on Pan-Tompkins
+ *
+ * Each sample goes through a 5-15 Hz band-pass filter, a derivative, squaring and a 150 ms
+ * moving window integrator. Each hump of the integrated signal (it ends when the signal falls
+ * to half its maximum) is classified as QRS or noise with two adaptive thresholds (signal and
+ * noise peak levels). The beat is placed at the highest band-passed sample of the hump. If no
+ * beat is found in 166 % of the mean RR interval, the highest hump above the second threshold
+ * is taken as a beat (search back).
+ *
+ * All the state has a fixed size and every sample takes a constant time, so blocks of any
+ * lenght can be processed as they arrive (ex: the 16 samples chunks of a plot task).
+ * The first 2 s are used to learn signal and noise levels: no beats are reported.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define QRS_MWI_MAX         128     /*!< Maximum integration window (samples): 150 ms up to 850 Hz */
+#define QRS_RR_AVG          8       /*!< RR intervals averaged */
+/*==================[typedef]================================================*/
+/**
+ * @brief QRS detector
+ */
+typedef struct {
+    float sample_freq;              /*!< Signal's sample frequency */
+    /* internal */
+    float lp_coeffs[5];             /*!< Band-pass filter: low pass coefficients */
+    float lp_w[2];                  /*!< Band-pass filter: low pass state */
+    float hp_coeffs[5];             /*!< Band-pass filter: hi pass coefficients */
+    float hp_w[2];                  /*!< Band-pass filter: hi pass state */
+    float deriv[4];                 /*!< Last band-passed samples (derivative) */
+    float mwi[QRS_MWI_MAX];         /*!< Squared samples in the integration window */
+    float mwi_sum;                  /*!< Sum of the integration window */
+    uint16_t mwi_len;               /*!< Integration window lenght */
+    uint16_t mwi_pos;               /*!< Position in the integration window */
+    float hump_max;                 /*!< Maximum of current hump */
+    float trough;                   /*!< Minimum since last hump */
+    bool rising;                    /*!< A hump started */
+    float x_max;                    /*!< Highest band-passed sample since last hump */
+    uint32_t x_time;                /*!< Time of x_max */
+    float spk;                      /*!< Signal peak level */
+    float npk;                      /*!< Noise peak level */
+    float threshold;                /*!< First threshold */
+    float sb_peak;                  /*!< Highest noise peak since last beat (search back) */
+    uint32_t sb_time;               /*!< Time of sb_peak */
+    uint32_t time;                  /*!< Samples processed */
+    uint32_t last_beat;             /*!< Time of last beat */
+    uint32_t refractory;            /*!< Minimum samples between beats (200 ms) */
+    uint32_t learn;                 /*!< Samples of learning phase */
+    float learn_max;                /*!< Learning phase: highest integrated sample */
+    float learn_sum;                /*!< Learning phase: sum of integrated samples */
+    uint32_t rr[QRS_RR_AVG];        /*!< Last RR intervals (samples) */
+    uint32_t rr_sum;                /*!< Sum of rr */
+    uint8_t rr_pos;                 /*!< Position in rr */
+    uint8_t n_rr;                   /*!< Valid values in rr */
+    uint32_t rr_limit;              /*!< 166 % of mean RR interval (search back) */
+    bool first_beat;                /*!< No beat detected yet */
+} qrs_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a QRS detector
+ *
+ * @param detector      QRS detector with its configuration
+ */
+void QrsDetectorInit(qrs_detector_t *detector);
+
+/**
+ * @brief Processes a block of ECG samples
+ *
+ * @param detector      QRS detector
+ * @param signal        ECG signal array
+ * @param signal_lenght Number of samples of signal
+ * @param rr_ms         Array to store the RR interval (ms) of each beat detected (0 for the first
+ *                      one), or NULL (of lenght = signal_lenght * 5 / sample_freq + 2)
+ * @return uint8_t      Number of beats detected
+ */
+uint8_t QrsDetectorProcess(qrs_detector_t *detector, const float *signal, uint16_t signal_lenght, uint16_t *rr_ms);
+
+/**
+ * @brief Heart rate, from the mean of the last QRS_RR_AVG RR intervals
+ *
+ * @param detector      QRS detector
+ * @return uint16_t     Heart rate (bpm), 0 until two beats are detected
+ */
+uint16_t QrsDetectorHeartRate(qrs_detector_t *detector);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* QRS_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
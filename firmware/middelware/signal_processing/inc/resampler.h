@@ -0,0 +1,131 @@
+#ifndef RESAMPLER_H_
+#define RESAMPLER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Resampler Resampler
+ */
+
+/** \brief Sample rate conversion of signals processed in blocks
+ *
+ * Two converters are available, both keep their state between blocks:
+ *
+ * - Decimator: a CIC filter (integer additions and subtractions only) decimates by cic_ratio,
+ *   followed by a FIR filter that compensates the CIC passband droop and decimates by fir_ratio.
+ *   Useful to oversample a signal to reduce noise and decimate it cheaply (ex: ADC at 20 kSPS,
+ *   cic_ratio = 40 and fir_ratio = 2 gives 250 Hz for ECG).
+ * - Resampler: polyphase FIR that changes the sample rate by up / down (ex: 8000 Hz to 48000 Hz
+ *   with up = 6 and down = 1, 48000 Hz to 32000 Hz with up = 2 and down = 3). Only the
+ *   taps of the phase needed for each output sample are calculated.
+ *
+ * @note CIC integrators wrap around: input bits + cic_order * log2(cic_ratio) must be 32 or less
+ * (ex: 12 bits ADC values, cic_order = 3, cic_ratio = 40 -> 28 bits).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define CIC_ORDER_MAX           5       /*!< Maximum CIC filter order */
+#define FIR_RATIO_MAX           8       /*!< Maximum FIR stage decimation factor */
+#define DECIMATOR_TAPS_MAX      64      /*!< Maximum compensation FIR taps */
+#define RESAMPLER_UP_MAX        32      /*!< Maximum interpolation factor (phases) */
+#define RESAMPLER_TAPS_MAX      16      /*!< Maximum taps per phase */
+
+/**
+ * @brief Maximum number of samples returned by ResamplerProcess() for n input samples
+ */
+#define RESAMPLER_OUT_MAX(n, up, down)  (((uint32_t)(n) * (up) + (down) - 1) / (down))
+/*==================[typedef]================================================*/
+/**
+ * @brief CIC + FIR decimator
+ */
+typedef struct {
+    uint16_t cic_ratio;         /*!< CIC decimation factor (1: no CIC stage) */
+    uint8_t cic_order;          /*!< CIC order (1 to CIC_ORDER_MAX) */
+    uint8_t fir_ratio;          /*!< FIR decimation factor (1 to FIR_RATIO_MAX) */
+    uint8_t fir_taps;           /*!< Compensation FIR taps (DECIMATOR_TAPS_MAX max) */
+    float passband;             /*!< Passband edge, as a fraction of the output sample rate (less than 0.5) */
+    /* internal */
+    uint32_t integ[CIC_ORDER_MAX];      /*!< CIC integrators */
+    uint32_t comb[CIC_ORDER_MAX];       /*!< CIC comb delays */
+    uint16_t count;                     /*!< Input samples since last CIC output */
+    float cic_gain;                     /*!< 1 / CIC DC gain */
+    float cic_out[FIR_RATIO_MAX];       /*!< CIC output waiting for the FIR stage */
+    uint8_t n_cic_out;                  /*!< Samples in cic_out */
+    float coeffs[DECIMATOR_TAPS_MAX];   /*!< Compensation FIR coefficients */
+    float delay[DECIMATOR_TAPS_MAX];    /*!< Compensation FIR delay line */
+    fir_f32_t fir;                      /*!< Compensation FIR */
+} decimator_t;
+
+/**
+ * @brief Rational (up / down) polyphase resampler
+ */
+typedef struct {
+    uint8_t up;                 /*!< Interpolation factor (RESAMPLER_UP_MAX max) */
+    uint8_t down;               /*!< Decimation factor */
+    uint8_t taps;               /*!< Taps per phase (RESAMPLER_TAPS_MAX max) */
+    float passband;             /*!< Filter cut-off (-6 dB), as a fraction of the lower Nyquist frequency (ex: 0.9) */
+    /* internal */
+    float coeffs[RESAMPLER_UP_MAX * RESAMPLER_TAPS_MAX];  /*!< Filter taps, by phase */
+    float history[2 * RESAMPLER_TAPS_MAX];  /*!< Last input samples (stored twice) */
+    uint8_t pos;                /*!< Position in history */
+    uint16_t phase;             /*!< Phase of next output sample */
+} resampler_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Designs the compensation filter and clears the decimator state
+ *
+ * @param decimator     Decimator with its configuration
+ */
+void DecimatorInit(decimator_t *decimator);
+
+/**
+ * @brief Decimates a block of samples
+ *
+ * @note Blocks of any lenght can be used: samples left over are kept for the next block
+ *
+ * @param decimator     Decimator
+ * @param input         Input signal array
+ * @param output        Output signal array (of lenght = signal_lenght / (cic_ratio * fir_ratio) + 1)
+ * @param signal_lenght Number of samples of input signal
+ * @return uint16_t     Number of samples stored in output
+ */
+uint16_t DecimatorProcess(decimator_t *decimator, const int16_t *input, float *output, uint16_t signal_lenght);
+
+/**
+ * @brief Designs the polyphase filter and clears the resampler state
+ *
+ * @param resampler     Resampler with its configuration
+ */
+void ResamplerInit(resampler_t *resampler);
+
+/**
+ * @brief Resamples a block of samples
+ *
+ * @param resampler     Resampler
+ * @param input         Input signal array
+ * @param output        Output signal array (of lenght = RESAMPLER_OUT_MAX(signal_lenght, up, down))
+ * @param signal_lenght Number of samples of input signal
+ * @return uint16_t     Number of samples stored in output
+ */
+uint16_t ResamplerProcess(resampler_t *resampler, const float *input, float *output, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RESAMPLER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,86 @@
+#ifndef RUNNING_MEDIAN_H_
+#define RUNNING_MEDIAN_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Running_Median Running Median
+ */
+
+/** \brief Running median (or any percentile) over the last samples of a sensor
+ *
+ * Robust smoothing for readings with spikes or outliers (ex: HcSr04ReadDistanceInCentimeters(),
+ * HX711_read()): unlike a mean, a single wrong reading doesn't move the output.
+ *
+ * Samples of the window are kept in two heaps: the lowest ones (max-heap) and the highest
+ * ones (min-heap), split at the percentile rank. Each new sample replaces the oldest one in
+ * O(log window) time, instead of sorting the whole window. Memory has a fixed size, no sensor
+ * driver dependency: readings are passed as float (exact up to 24 bits).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define RUNNING_MEDIAN_MAX  64      /*!< Maximum window lenght */
+/*==================[typedef]================================================*/
+/**
+ * @brief Running median / percentile filter
+ */
+typedef struct {
+    uint8_t window;                         /*!< Samples in the window (1 to RUNNING_MEDIAN_MAX, ex: 5) */
+    uint8_t percentile;                     /*!< Percentile given (0: minimum, 50: median, 100: maximum) */
+    /* internal */
+    float value[RUNNING_MEDIAN_MAX];        /*!< Samples of the window (circular buffer) */
+    uint8_t low[RUNNING_MEDIAN_MAX];        /*!< Max-heap of the lowest samples (positions in value) */
+    uint8_t high[RUNNING_MEDIAN_MAX];       /*!< Min-heap of the highest samples (positions in value) */
+    uint8_t where[RUNNING_MEDIAN_MAX];      /*!< Position in its heap of each sample */
+    bool in_low[RUNNING_MEDIAN_MAX];        /*!< Heap of each sample */
+    uint8_t n_low;                          /*!< Samples in low */
+    uint8_t n_high;                         /*!< Samples in high */
+    uint8_t pos;                            /*!< Oldest sample (next to be replaced) */
+} running_median_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize (empty) a running median filter
+ *
+ * @param filter        Running median filter with its configuration
+ */
+void RunningMedianInit(running_median_t *filter);
+
+/**
+ * @brief Adds a sample (the oldest one leaves the window once it is full)
+ *
+ * @param filter        Running median filter
+ * @param sample        New sample
+ * @return float        Percentile of the samples in the window (nearest rank)
+ */
+float RunningMedianUpdate(running_median_t *filter, float sample);
+
+/**
+ * @brief Filters a block of samples
+ *
+ * @param filter        Running median filter
+ * @param input         Input samples
+ * @param output        Array to store the percentile after each sample (can be input)
+ * @param signal_lenght Number of samples
+ */
+void RunningMedianProcess(running_median_t *filter, const float *input, float *output, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RUNNING_MEDIAN_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,96 @@
+/**
+ * @file adpcm.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief IMA-ADPCM streaming decoder
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "adpcm.h"
+/*==================[macros and definitions]=================================*/
+#define ADPCM_INDEX_MAX     88
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** Quantizer step for each step index */
+static const int16_t step_table[ADPCM_INDEX_MAX + 1] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+/** Step index change for each code (sign bit excluded) */
+static const int8_t index_table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void AdpcmInit(adpcm_t *adpcm, const uint8_t *data, uint32_t n_samples){
+    adpcm->data = data;
+    adpcm->n_samples = n_samples;
+    adpcm->pos = 0;
+    adpcm->predictor = 0;
+    adpcm->index = 0;
+}
+
+uint16_t AdpcmDecode(adpcm_t *adpcm, int16_t *out, uint16_t samples){
+    int32_t predictor = adpcm->predictor;
+    int32_t index = adpcm->index;
+    uint32_t pos = adpcm->pos;
+    int32_t step, diff;
+    uint8_t code;
+    uint16_t n = samples;
+
+    if(adpcm->n_samples - pos < n){
+        n = adpcm->n_samples - pos;
+    }
+    for(uint16_t i=0; i<n; i++, pos++){
+        code = adpcm->data[pos >> 1];
+        code = (pos & 1) ? (code >> 4) : (code & 0x0F);
+        step = step_table[index];
+        /* diff = (code + 0.5) * step / 4, without multiplications */
+        diff = step >> 3;
+        if(code & 4){
+            diff += step;
+        }
+        if(code & 2){
+            diff += step >> 1;
+        }
+        if(code & 1){
+            diff += step >> 2;
+        }
+        if(code & 8){
+            predictor -= diff;
+            if(predictor < INT16_MIN){
+                predictor = INT16_MIN;
+            }
+        }else{
+            predictor += diff;
+            if(predictor > INT16_MAX){
+                predictor = INT16_MAX;
+            }
+        }
+        index += index_table[code & 7];
+        if(index < 0){
+            index = 0;
+        }else if(index > ADPCM_INDEX_MAX){
+            index = ADPCM_INDEX_MAX;
+        }
+        out[i] = (int16_t)predictor;
+    }
+    adpcm->predictor = (int16_t)predictor;
+    adpcm->index = (uint8_t)index;
+    adpcm->pos = pos;
+    return n;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,154 @@
+/**
+ * @file band_analyzer.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Log/mel band analyzer for spectrum bars
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <stddef.h>
+#include "band_analyzer.h"
+/*==================[macros and definitions]=================================*/
+#define POWER_MIN   1e-12f      /* avoid log(0) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static float HzToMel(float f){
+    return 2595.0f * log10f(1.0f + f / 700.0f);
+}
+
+static float MelToHz(float m){
+    return 700.0f * (powf(10.0f, m / 2595.0f) - 1.0f);
+}
+
+/**
+ * @brief Upper edge (Hz) of band i
+ */
+static float BandEdge(band_analyzer_t *analyzer, uint8_t i){
+    float frac = (float)(i + 1) / analyzer->n_bands;
+    if(analyzer->scale == BAND_SCALE_MEL){
+        float m_min = HzToMel(analyzer->f_min);
+        return MelToHz(m_min + (HzToMel(analyzer->f_max) - m_min) * frac);
+    }
+    return analyzer->f_min * powf(analyzer->f_max / analyzer->f_min, frac);
+}
+
+/**
+ * @brief Level (dB) to bar height (0 to 255)
+ */
+static uint8_t Quantize(float level, float floor_db, float steps_db){
+    float h = (level - floor_db) * steps_db;
+    if(h <= 0){
+        return 0;
+    }
+    if(h >= 255){
+        return 255;
+    }
+    return (uint8_t)h;
+}
+
+/*==================[external functions definition]==========================*/
+void BandAnalyzerInit(band_analyzer_t *analyzer){
+    uint16_t n_bins = analyzer->signal_lenght / 2;
+    float bin_width = analyzer->sample_freq / analyzer->signal_lenght;
+    float x0, x1;
+    int32_t first, last;
+
+    if(analyzer->n_bands > BANDS_MAX){
+        analyzer->n_bands = BANDS_MAX;
+    }
+    if(analyzer->f_max > analyzer->sample_freq / 2){
+        analyzer->f_max = analyzer->sample_freq / 2;
+    }
+    if(analyzer->f_min < bin_width / 2){
+        analyzer->f_min = bin_width / 2;
+    }
+    /* Bin j covers [j - 0.5, j + 0.5) (in bins) */
+    x1 = analyzer->f_min / bin_width;
+    for(uint8_t i=0; i<analyzer->n_bands; i++){
+        x0 = x1;
+        x1 = BandEdge(analyzer, i) / bin_width;
+        if(x1 > n_bins - 0.5f){
+            x1 = n_bins - 0.5f;
+        }
+        first = (int32_t)(x0 + 0.5f);
+        last = (int32_t)(x1 + 0.5f);
+        if(last > n_bins - 1){
+            last = n_bins - 1;
+        }
+        if(last < first){
+            last = first;
+        }
+        analyzer->first[i] = first;
+        analyzer->last[i] = last;
+        if(first == last){
+            analyzer->w_first[i] = x1 - x0;
+            analyzer->w_last[i] = 0;
+        }else{
+            analyzer->w_first[i] = (first + 0.5f) - x0;
+            analyzer->w_last[i] = x1 - (last - 0.5f);
+        }
+        analyzer->band_scale[i] = (x1 > x0) ? 1.0f / (x1 - x0) : 0;
+        analyzer->level[i] = analyzer->floor_db;
+        analyzer->peak[i] = analyzer->floor_db;
+        analyzer->hold[i] = 0;
+    }
+}
+
+void BandAnalyzerUpdate(band_analyzer_t *analyzer, const float *power, uint8_t *bars, uint8_t *peaks){
+    float steps_db = 255.0f / analyzer->range_db;
+    float sum, level;
+
+    for(uint8_t i=0; i<analyzer->n_bands; i++){
+        /* Mean power of the band */
+        sum = analyzer->w_first[i] * power[analyzer->first[i]];
+        for(uint16_t j=analyzer->first[i]+1; j<analyzer->last[i]; j++){
+            sum += power[j];
+        }
+        if(analyzer->last[i] > analyzer->first[i]){
+            sum += analyzer->w_last[i] * power[analyzer->last[i]];
+        }
+        sum *= analyzer->band_scale[i];
+        if(sum < POWER_MIN){
+            sum = POWER_MIN;
+        }
+        level = 10.0f * log10f(sum);
+        /* Attack / decay */
+        if(level > analyzer->level[i]){
+            analyzer->level[i] += analyzer->attack * (level - analyzer->level[i]);
+        }else if(analyzer->level[i] - level > analyzer->decay){
+            analyzer->level[i] -= analyzer->decay;
+        }else{
+            analyzer->level[i] = level;
+        }
+        /* Peak hold */
+        if(analyzer->level[i] >= analyzer->peak[i]){
+            analyzer->peak[i] = analyzer->level[i];
+            analyzer->hold[i] = analyzer->peak_hold;
+        }else if(analyzer->hold[i] > 0){
+            analyzer->hold[i]--;
+        }else{
+            analyzer->peak[i] -= analyzer->peak_decay;
+            if(analyzer->peak[i] < analyzer->level[i]){
+                analyzer->peak[i] = analyzer->level[i];
+            }
+        }
+        bars[i] = Quantize(analyzer->level[i], analyzer->floor_db, steps_db);
+        if(peaks != NULL){
+            peaks[i] = Quantize(analyzer->peak[i], analyzer->floor_db, steps_db);
+        }
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,399 @@
+/**
+ * @file ecg_codec.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief ECG compression (lossless and DCT based)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <stdbool.h>
+#include "ecg_codec.h"
+#include "dsps_dct.h"
+/*==================[macros and definitions]=================================*/
+#define HEADER_BYTES    2       /* Mode and samples, Rice parameter */
+#define RICE_K_MAX      20      /* Maximum Rice parameter */
+#define PREDICTOR_MAX   2       /* Maximum predictor order */
+#define RICE_ESCAPE     16      /* Quotient from which values are written raw */
+#define RAW_BITS        24      /* Bits of raw values (zigzag) */
+#define STEP_MIN        48      /* Smallest quantization step index (step = 1 / 4) */
+#define STEP_MAX        255     /* Largest quantization step index */
+#define DC_BITS         24      /* Bits of quantized DC coefficient */
+
+/**
+ * @brief Bit stream
+ */
+typedef struct {
+    uint8_t *data;
+    uint32_t bit;               /* Bits written or read */
+    uint32_t size;              /* Bits available (decoder) */
+} bit_stream_t;
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static float dct[2 * ECG_CODEC_BLOCK_MAX];    /* dsps_dct_f32 needs 2 * N */
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void BitsWrite(bit_stream_t *bits, uint32_t value, uint8_t n){
+    while(n > 0){
+        n--;
+        if((bits->bit & 7) == 0){
+            bits->data[bits->bit >> 3] = 0;
+        }
+        if((value >> n) & 1){
+            bits->data[bits->bit >> 3] |= 0x80 >> (bits->bit & 7);
+        }
+        bits->bit++;
+    }
+}
+
+/**
+ * @brief Reads n bits, false if there are not enough bits
+ */
+static bool BitsRead(bit_stream_t *bits, uint32_t *value, uint8_t n){
+    if(bits->bit + n > bits->size){
+        return false;
+    }
+    *value = 0;
+    while(n > 0){
+        n--;
+        *value = (*value << 1) | ((bits->data[bits->bit >> 3] >> (7 - (bits->bit & 7))) & 1);
+        bits->bit++;
+    }
+    return true;
+}
+
+/**
+ * @brief Signed to unsigned: 0, -1, 1, -2, 2 ... to 0, 1, 2, 3, 4 ...
+ */
+static uint32_t ZigZag(int32_t x){
+    return (x < 0) ? ((uint32_t)(-(x + 1)) << 1) | 1 : (uint32_t)x << 1;
+}
+
+static int32_t UnZigZag(uint32_t u){
+    return (u & 1) ? -(int32_t)(u >> 1) - 1 : (int32_t)(u >> 1);
+}
+
+/**
+ * @brief Bits of a Rice coded value
+ */
+static uint32_t RiceBits(uint32_t u, uint8_t k){
+    uint32_t q = u >> k;
+    return (q < RICE_ESCAPE) ? q + 1 + k : RICE_ESCAPE + RAW_BITS;
+}
+
+/**
+ * @brief Rice parameter with the fewest bits for n values
+ */
+static uint8_t RiceParameter(const uint32_t *u, uint8_t n){
+    uint32_t bits, best_bits = UINT32_MAX;
+    uint8_t best = 0;
+    for(uint8_t k=0; k<=RICE_K_MAX; k++){
+        bits = 0;
+        for(uint8_t i=0; i<n; i++){
+            bits += RiceBits(u[i], k);
+        }
+        if(bits < best_bits){
+            best_bits = bits;
+            best = k;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Rice code: quotient in unary (ones ended by a zero) and k bits of remainder. Large
+ * values: RICE_ESCAPE ones and the value in RAW_BITS bits.
+ */
+static void RiceWrite(bit_stream_t *bits, uint32_t u, uint8_t k){
+    uint32_t q = u >> k;
+    if(q < RICE_ESCAPE){
+        BitsWrite(bits, (1UL << q) - 1, q);
+        BitsWrite(bits, 0, 1);
+        BitsWrite(bits, u, k);
+    }else{
+        BitsWrite(bits, (1UL << RICE_ESCAPE) - 1, RICE_ESCAPE);
+        BitsWrite(bits, u, RAW_BITS);
+    }
+}
+
+static bool RiceRead(bit_stream_t *bits, uint32_t *u, uint8_t k){
+    uint32_t q = 0, bit, r;
+    do{
+        if(!BitsRead(bits, &bit, 1)){
+            return false;
+        }
+        q += bit;
+    }while(bit && q < RICE_ESCAPE);
+    if(q == RICE_ESCAPE){
+        return BitsRead(bits, u, RAW_BITS);
+    }
+    if(!BitsRead(bits, &r, k)){
+        return false;
+    }
+    *u = (q << k) | r;
+    return true;
+}
+
+static float StepSize(uint8_t index){
+    return exp2f((index - 64) / 8.0f);
+}
+
+static int16_t Saturate(float x){
+    x = roundf(x);
+    if(x > INT16_MAX){
+        return INT16_MAX;
+    }
+    if(x < INT16_MIN){
+        return INT16_MIN;
+    }
+    return x;
+}
+
+/**
+ * @brief Orthonormal DCT-III of n coefficients (dct array) to samples
+ */
+static void InverseDct(const float *coeff, uint8_t n, int16_t *signal){
+    for(uint8_t i=0; i<n; i++){
+        /* dsps_dct_inv_f32 gives n / 2 times the samples of unscaled coefficients */
+        dct[i] = coeff[i] * ((i == 0) ? 2 : sqrtf(2)) / sqrtf(n);
+    }
+    dsps_dct_inv_f32(dct, n);
+    for(uint8_t i=0; i<n; i++){
+        signal[i] = Saturate(dct[i]);
+    }
+}
+
+/**
+ * @brief Fixed predictor of order 0 to 2 for sample i (lower orders at block start)
+ */
+static int32_t Prediction(const int16_t *signal, uint8_t i, uint8_t order){
+    if(order > i){
+        order = i;
+    }
+    switch(order){
+    case 1:
+        return signal[i - 1];
+    case 2:
+        return 2 * signal[i - 1] - signal[i - 2];
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Lossless packet of n samples, with the predictor order that gives the fewest bits
+ */
+static uint16_t EncodeLossless(const int16_t *signal, uint8_t n, uint8_t *data){
+    uint32_t u[ECG_CODEC_BLOCK_MAX], bits_total, best_bits = UINT32_MAX;
+    bit_stream_t bits = {.data = data};
+    uint8_t k, best_k = 0, best_order = 0;
+
+    for(uint8_t order=0; order<=PREDICTOR_MAX; order++){
+        for(uint8_t i=1; i<n; i++){
+            u[i] = ZigZag(signal[i] - Prediction(signal, i, order));
+        }
+        k = RiceParameter(&u[1], n - 1);
+        bits_total = 0;
+        for(uint8_t i=1; i<n; i++){
+            bits_total += RiceBits(u[i], k);
+        }
+        if(bits_total < best_bits){
+            best_bits = bits_total;
+            best_k = k;
+            best_order = order;
+        }
+    }
+    BitsWrite(&bits, ECG_CODEC_LOSSLESS, 1);
+    BitsWrite(&bits, n - 1, 7);
+    BitsWrite(&bits, best_order, 3);
+    BitsWrite(&bits, best_k, 5);
+    BitsWrite(&bits, (uint16_t)signal[0], 16);
+    for(uint8_t i=1; i<n; i++){
+        RiceWrite(&bits, ZigZag(signal[i] - Prediction(signal, i, best_order)), best_k);
+    }
+    return (bits.bit + 7) / 8;
+}
+
+/**
+ * @brief DCT packet of n samples (power of two), PRD under prd
+ */
+static uint16_t EncodeDct(const int16_t *signal, uint8_t n, float prd, uint8_t *data){
+    float coeff[ECG_CODEC_BLOCK_MAX], quantized[ECG_CODEC_BLOCK_MAX];
+    float error, target, mean = 0, energy = 0, step, e;
+    int32_t q[ECG_CODEC_BLOCK_MAX];
+    uint32_t u[ECG_CODEC_BLOCK_MAX];
+    int16_t decoded[ECG_CODEC_BLOCK_MAX];
+    bit_stream_t bits = {.data = data};
+    uint8_t low = STEP_MIN, high = STEP_MAX, index, last, k;
+
+    for(uint8_t i=0; i<n; i++){
+        mean += signal[i];
+        dct[i] = signal[i];
+    }
+    mean /= n;
+    for(uint8_t i=0; i<n; i++){
+        energy += (signal[i] - mean) * (signal[i] - mean);
+    }
+    /* At least 1 LSB rms, so flat blocks don't need an exact DC */
+    if(energy < n){
+        energy = n;
+    }
+    target = energy * (prd / 100) * (prd / 100);
+    /* Orthonormal coefficients: quantization error energy is the same in time (Parseval) */
+    dsps_dct_f32(dct, n);
+    for(uint8_t i=0; i<n; i++){
+        coeff[i] = dct[i] * ((i == 0) ? 1 : sqrtf(2)) / sqrtf(n);
+    }
+    /* Largest step under the target (binary search), checked with the samples decoded
+     * (rounding adds error): if it is over the target, search again with smaller steps */
+    while(true){
+        while(low < high){
+            index = (low + high + 1) / 2;
+            step = StepSize(index);
+            error = 0;
+            for(uint8_t i=0; i<n; i++){
+                e = coeff[i] - roundf(coeff[i] / step) * step;
+                error += e * e;
+            }
+            if(error <= target){
+                low = index;
+            }else{
+                high = index - 1;
+            }
+        }
+        index = low;
+        step = StepSize(index);
+        for(uint8_t i=0; i<n; i++){
+            q[i] = roundf(coeff[i] / step);
+            quantized[i] = q[i] * step;
+        }
+        InverseDct(quantized, n, decoded);
+        error = 0;
+        for(uint8_t i=0; i<n; i++){
+            error += (float)(decoded[i] - signal[i]) * (decoded[i] - signal[i]);
+        }
+        if(error <= target || index == STEP_MIN){
+            break;
+        }
+        low = STEP_MIN;
+        high = index - 1;
+    }
+    last = 0;
+    for(uint8_t i=1; i<n; i++){
+        u[i] = ZigZag(q[i]);
+        if(q[i] != 0){
+            last = i;
+        }
+    }
+    k = (last > 0) ? RiceParameter(&u[1], last) : 0;
+    BitsWrite(&bits, ECG_CODEC_DCT, 1);
+    BitsWrite(&bits, n - 1, 7);
+    BitsWrite(&bits, 0, 3);
+    BitsWrite(&bits, k, 5);
+    BitsWrite(&bits, index, 8);
+    BitsWrite(&bits, last, 8);
+    BitsWrite(&bits, (uint32_t)q[0] & ((1UL << DC_BITS) - 1), DC_BITS);
+    for(uint8_t i=1; i<=last; i++){
+        RiceWrite(&bits, u[i], k);
+    }
+    return (bits.bit + 7) / 8;
+}
+
+static bool PowerOfTwo(uint8_t n){
+    return (n & (n - 1)) == 0;
+}
+
+/*==================[external functions definition]==========================*/
+void EcgCodecInit(ecg_codec_t *codec){
+    if(codec->block_lenght < 2){
+        codec->block_lenght = 2;
+    }
+    if(codec->block_lenght > ECG_CODEC_BLOCK_MAX){
+        codec->block_lenght = ECG_CODEC_BLOCK_MAX;
+    }
+    codec->count = 0;
+}
+
+uint16_t EcgCodecEncode(ecg_codec_t *codec, const int16_t *signal, uint16_t signal_lenght, uint8_t *data){
+    uint16_t bytes = 0;
+
+    for(uint16_t i=0; i<signal_lenght; i++){
+        codec->block[codec->count++] = signal[i];
+        if(codec->count < codec->block_lenght){
+            continue;
+        }
+        if(codec->mode == ECG_CODEC_DCT && PowerOfTwo(codec->block_lenght)){
+            bytes += EncodeDct(codec->block, codec->count, codec->prd, &data[bytes]);
+        }else{
+            bytes += EncodeLossless(codec->block, codec->count, &data[bytes]);
+        }
+        codec->count = 0;
+    }
+    return bytes;
+}
+
+uint16_t EcgCodecFlush(ecg_codec_t *codec, uint8_t *data){
+    uint16_t bytes = 0;
+    if(codec->count > 0){
+        bytes = EncodeLossless(codec->block, codec->count, data);
+        codec->count = 0;
+    }
+    return bytes;
+}
+
+uint16_t EcgCodecDecode(const uint8_t *data, uint16_t size, int16_t *signal, uint16_t *signal_lenght){
+    bit_stream_t bits = {.data = (uint8_t *)data, .size = (uint32_t)size * 8};
+    uint32_t mode, n, order, k, value, index, last;
+
+    if(!BitsRead(&bits, &mode, 1) || !BitsRead(&bits, &n, 7) || !BitsRead(&bits, &order, 3) ||
+       !BitsRead(&bits, &k, 5)){
+        return 0;
+    }
+    n++;
+    if(n > ECG_CODEC_BLOCK_MAX || k > RICE_K_MAX || order > PREDICTOR_MAX){
+        return 0;
+    }
+    if(mode == ECG_CODEC_LOSSLESS){
+        if(!BitsRead(&bits, &value, 16)){
+            return 0;
+        }
+        signal[0] = (int16_t)value;
+        for(uint8_t i=1; i<n; i++){
+            if(!RiceRead(&bits, &value, k)){
+                return 0;
+            }
+            signal[i] = Prediction(signal, i, order) + UnZigZag(value);
+        }
+    }else{
+        float coeff[ECG_CODEC_BLOCK_MAX], step;
+        if(!PowerOfTwo(n) || !BitsRead(&bits, &index, 8) || !BitsRead(&bits, &last, 8) ||
+           !BitsRead(&bits, &value, DC_BITS) || last >= n){
+            return 0;
+        }
+        step = StepSize(index);
+        /* Sign extension of DC */
+        coeff[0] = (((int32_t)(value << (32 - DC_BITS))) >> (32 - DC_BITS)) * step;
+        for(uint8_t i=1; i<n; i++){
+            coeff[i] = 0;
+            if(i <= last){
+                if(!RiceRead(&bits, &value, k)){
+                    return 0;
+                }
+                coeff[i] = UnZigZag(value) * step;
+            }
+        }
+        InverseDct(coeff, n, signal);
+    }
+    *signal_lenght = n;
+    return (bits.bit + 7) / 8;
+}
+
+/*==================[end of file]============================================*/
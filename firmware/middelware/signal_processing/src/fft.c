@@ -20,6 +20,8 @@
 /*==================[internal data declaration]==============================*/
 static float fft_complex[2 * MAX_SIGNAL_LENGHT];
 static float wind[MAX_SIGNAL_LENGHT];
+static uint16_t wind_lenght = 0;
+static float wind_power = 0;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -27,21 +29,29 @@ static float wind[MAX_SIGNAL_LENGHT];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-
-/*==================[external functions definition]==========================*/
-bool FFTInit(void){
-    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
-    if (ret != ESP_OK){
-        return false;
+/**
+ * @brief Hann window of signal_lenght samples in wind, only generated when lenght changes
+ */
+static void FFTWindow(uint16_t signal_lenght){
+    if(signal_lenght == wind_lenght){
+        return;
+    }
+    dsps_wind_hann_f32(wind, signal_lenght);
+    wind_lenght = signal_lenght;
+    // Window power (sum of squares), for PSD scaling
+    wind_power = 0;
+    for (int j = 0; j < signal_lenght; j++){
+        wind_power += wind[j] * wind[j];
     }
-    return true;
 }
 
-void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
-    // Generate Hann window
-    dsps_wind_hann_f32(wind, signal_lenght);
-    // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
+/**
+ * @brief Windowed FFT of signal, result (complex) in fft_complex
+ */
+static void FFTCompute(const float * signal, uint16_t signal_lenght){
+    FFTWindow(signal_lenght);
+    // Clear fft array (imaginary parts must be zero)
+    memset(fft_complex, 0, 2 * signal_lenght * sizeof(float));
     // Multiply input array with window and store as real part
     dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
     // Calculate FFT  
@@ -50,6 +60,19 @@ void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
     dsps_bit_rev_fc32(fft_complex, signal_lenght);
     // Convert one complex vector to two complex vectors
     dsps_cplx2reC_fc32(fft_complex, signal_lenght);
+}
+
+/*==================[external functions definition]==========================*/
+bool FFTInit(void){
+    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    if (ret != ESP_OK){
+        return false;
+    }
+    return true;
+}
+
+void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
+    FFTCompute(signal, signal_lenght);
     // Calculate FFT magnitude 
     for (int j = 0; j < signal_lenght; j++){
             fft_complex[j] = 2*(sqrt(fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1])) / (signal_lenght/2);
@@ -59,6 +82,144 @@ void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
     memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
 }
 
+void FFTPower(float * signal, float * power, uint16_t signal_lenght){
+    // Same scale as FFTMagnitude squared: (2 / (N/2))^2
+    float scale = 16.0f / ((float)signal_lenght * signal_lenght);
+    FFTCompute(signal, signal_lenght);
+    for (int j = 0; j < signal_lenght / 2; j++){
+        power[j] = (fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1]) * scale;
+    }
+    power[0] = power[0] / 4;
+}
+
+void GoertzelInit(goertzel_t * goertzel){
+    float w;
+    if(goertzel->n_bins > GOERTZEL_BINS_MAX){
+        goertzel->n_bins = GOERTZEL_BINS_MAX;
+    }
+    if(goertzel->block_lenght < 1){
+        goertzel->block_lenght = 1;
+    }
+    for(uint8_t k=0; k<goertzel->n_bins; k++){
+        w = 2 * M_PI * goertzel->freq[k] / goertzel->sample_freq;
+        goertzel->coeff[k] = 2 * cosf(w);
+        goertzel->sin_w[k] = sinf(w);
+        goertzel->cos_end[k] = cosf(w * (goertzel->block_lenght - 1));
+        goertzel->sin_end[k] = sinf(w * (goertzel->block_lenght - 1));
+        // Amplitude of a sine: 2 |X| / N (|X| / N at DC)
+        goertzel->scale[k] = ((goertzel->freq[k] == 0) ? 1.0f : 2.0f) / goertzel->block_lenght;
+        goertzel->s1[k] = 0;
+        goertzel->s2[k] = 0;
+    }
+    goertzel->count = 0;
+}
+
+bool GoertzelProcess(goertzel_t * goertzel, const float * signal, uint16_t signal_lenght, float * magnitude, float * phase){
+    uint16_t i = 0, len;
+    float s0, s1, s2, re, im, x_re, x_im;
+    bool ready = false;
+
+    while(i < signal_lenght){
+        // Samples up to the end of the block, each bin's state is kept in registers
+        len = goertzel->block_lenght - goertzel->count;
+        if(len > signal_lenght - i){
+            len = signal_lenght - i;
+        }
+        for(uint8_t k=0; k<goertzel->n_bins; k++){
+            float coeff = goertzel->coeff[k];
+            s1 = goertzel->s1[k];
+            s2 = goertzel->s2[k];
+            for(uint16_t j=i; j<i+len; j++){
+                s0 = signal[j] + coeff * s1 - s2;
+                s2 = s1;
+                s1 = s0;
+            }
+            goertzel->s1[k] = s1;
+            goertzel->s2[k] = s2;
+        }
+        i += len;
+        goertzel->count += len;
+        if(goertzel->count < goertzel->block_lenght){
+            break;
+        }
+        // End of block: X = (s1 - s2 e^(-jw)) e^(-jw(N-1))
+        for(uint8_t k=0; k<goertzel->n_bins; k++){
+            s1 = goertzel->s1[k];
+            s2 = goertzel->s2[k];
+            re = s1 - s2 * goertzel->coeff[k] / 2;
+            im = s2 * goertzel->sin_w[k];
+            magnitude[k] = sqrtf(re * re + im * im) * goertzel->scale[k];
+            if(phase != NULL){
+                x_re = re * goertzel->cos_end[k] + im * goertzel->sin_end[k];
+                x_im = im * goertzel->cos_end[k] - re * goertzel->sin_end[k];
+                phase[k] = atan2f(x_im, x_re);
+            }
+            goertzel->s1[k] = 0;
+            goertzel->s2[k] = 0;
+        }
+        goertzel->count = 0;
+        ready = true;
+    }
+    return ready;
+}
+
+void WelchInit(welch_t * welch){
+    if(welch->segment_lenght > WELCH_LENGHT_MAX){
+        welch->segment_lenght = WELCH_LENGHT_MAX;
+    }
+    if(welch->overlap >= welch->segment_lenght){
+        welch->overlap = welch->segment_lenght / 2;
+    }
+    memset(welch->psd_sum, 0, sizeof(welch->psd_sum));
+    welch->count = 0;
+    welch->n_segments = 0;
+    FFTWindow(welch->segment_lenght);
+    // One-sided PSD: 2 |X|^2 / (fs * window power), FFTCompute gives 2X (X at DC)
+    welch->scale = 0.5f / (welch->sample_freq * wind_power);
+}
+
+uint16_t WelchProcess(welch_t * welch, const float * signal, uint16_t signal_lenght){
+    uint16_t i = 0, len, n = 0;
+    uint16_t lenght = welch->segment_lenght;
+
+    while(i < signal_lenght){
+        len = lenght - welch->count;
+        if(len > signal_lenght - i){
+            len = signal_lenght - i;
+        }
+        memcpy(&welch->segment[welch->count], &signal[i], len * sizeof(float));
+        welch->count += len;
+        i += len;
+        if(welch->count < lenght){
+            break;
+        }
+        // Segment completed: its power spectrum is added to the sum
+        FFTCompute(welch->segment, lenght);
+        for (int j = 0; j < lenght / 2; j++){
+            welch->psd_sum[j] += fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1];
+        }
+        welch->n_segments++;
+        n++;
+        // Overlapping samples are kept for the next segment
+        memmove(welch->segment, &welch->segment[lenght - welch->overlap], welch->overlap * sizeof(float));
+        welch->count = welch->overlap;
+    }
+    return n;
+}
+
+bool WelchPSD(welch_t * welch, float * psd){
+    if(welch->n_segments == 0){
+        return false;
+    }
+    float scale = welch->scale / welch->n_segments;
+    for (int j = 0; j < welch->segment_lenght / 2; j++){
+        psd[j] = welch->psd_sum[j] * scale;
+    }
+    // DC: not doubled by FFTCompute, nor folded from negative frequencies
+    psd[0] = psd[0] * 2;
+    return true;
+}
+
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
     float freq_step = sample_freq / (float)signal_lenght;
     for(uint16_t i=0; i<(signal_lenght/2); i++){
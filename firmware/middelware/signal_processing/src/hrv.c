@@ -0,0 +1,203 @@
+/**
+ * @file hrv.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Heart rate variability metrics
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "hrv.h"
+/*==================[macros and definitions]=================================*/
+#define HRV_NO_DIFF     INT16_MIN   /* Successive difference not valid */
+#define NN50_MS         50
+#define LF_MIN          0.04f       /* Hz */
+#define LF_HF           0.15f       /* Hz */
+#define HF_MAX          0.4f        /* Hz */
+#define N_FREQ          128         /* Maximum periodogram frequencies */
+#define SPAN_MIN        50000       /* Shortest window for frequency domain: 2 cycles of LF_MIN (ms) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Adds (sign = 1) or removes (sign = -1) a successive difference from the sums
+ */
+static void HrvDiff(hrv_t *hrv, int16_t diff, int8_t sign){
+    if(diff == HRV_NO_DIFF){
+        return;
+    }
+    uint32_t d2 = (int32_t)diff * diff;
+    bool nn50 = (diff > NN50_MS) || (diff < -NN50_MS);
+    if(sign > 0){
+        hrv->sum_diff2 += d2;
+        hrv->n_diff++;
+        hrv->nn50 += nn50;
+    }else{
+        hrv->sum_diff2 -= d2;
+        hrv->n_diff--;
+        hrv->nn50 -= nn50;
+    }
+}
+
+/**
+ * @brief Removes the oldest beat of the window
+ */
+static void HrvRemoveOldest(hrv_t *hrv){
+    uint16_t rr = hrv->rr[hrv->first];
+    hrv->sum_rr -= rr;
+    hrv->sum_rr2 -= (uint32_t)rr * rr;
+    hrv->first = (hrv->first + 1) % HRV_BEATS_MAX;
+    hrv->n--;
+    /* The new oldest beat has no previous beat in the window */
+    if(hrv->n > 0){
+        HrvDiff(hrv, hrv->diff[hrv->first], -1);
+        hrv->diff[hrv->first] = HRV_NO_DIFF;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+void HrvInit(hrv_t *hrv){
+    if(hrv->window_ms < HRV_WINDOW_MIN){
+        hrv->window_ms = HRV_WINDOW_MIN;
+    }else if(hrv->window_ms > HRV_WINDOW_MAX){
+        hrv->window_ms = HRV_WINDOW_MAX;
+    }
+    hrv->first = 0;
+    hrv->n = 0;
+    hrv->sum_rr = 0;
+    hrv->sum_rr2 = 0;
+    hrv->sum_diff2 = 0;
+    hrv->n_diff = 0;
+    hrv->nn50 = 0;
+    hrv->gap = true;
+}
+
+void HrvAddRR(hrv_t *hrv, uint16_t rr_ms){
+    uint16_t last, pos;
+    int16_t diff = HRV_NO_DIFF;
+
+    if(rr_ms < HRV_RR_MIN || rr_ms > HRV_RR_MAX){
+        hrv->gap = true;
+        return;
+    }
+    if(hrv->n == HRV_BEATS_MAX){
+        HrvRemoveOldest(hrv);
+    }
+    if(hrv->n > 0 && !hrv->gap){
+        last = (hrv->first + hrv->n - 1) % HRV_BEATS_MAX;
+        diff = (int16_t)rr_ms - (int16_t)hrv->rr[last];
+    }
+    pos = (hrv->first + hrv->n) % HRV_BEATS_MAX;
+    hrv->rr[pos] = rr_ms;
+    hrv->diff[pos] = diff;
+    hrv->n++;
+    hrv->sum_rr += rr_ms;
+    hrv->sum_rr2 += (uint32_t)rr_ms * rr_ms;
+    HrvDiff(hrv, diff, 1);
+    hrv->gap = false;
+    /* Sliding window */
+    while(hrv->n > 1 && hrv->sum_rr - hrv->rr[hrv->first] >= hrv->window_ms){
+        HrvRemoveOldest(hrv);
+    }
+}
+
+bool HrvTimeDomain(hrv_t *hrv, hrv_time_t *metrics){
+    if(hrv->n < 3 || hrv->n_diff == 0){
+        return false;
+    }
+    float mean = (float)hrv->sum_rr / hrv->n;
+    /* Sum of squared deviations, exact in integers: n * sum(x^2) - sum(x)^2 */
+    uint64_t ss = hrv->n * hrv->sum_rr2 - (uint64_t)hrv->sum_rr * hrv->sum_rr;
+    metrics->mean_rr = mean;
+    metrics->sdnn = sqrtf((float)ss / ((float)hrv->n * (hrv->n - 1)));
+    metrics->rmssd = sqrtf((float)hrv->sum_diff2 / hrv->n_diff);
+    metrics->pnn50 = 100.0f * hrv->nn50 / hrv->n_diff;
+    return true;
+}
+
+bool HrvFreqDomain(hrv_t *hrv, hrv_freq_t *metrics){
+    /* Lomb-Scargle sums for each frequency: C = sum(y*cos), S = sum(y*sin), CC = sum(cos^2),
+     * SS = sum(sin^2), CS = sum(cos*sin) */
+    static float sum_c[N_FREQ], sum_s[N_FREQ], sum_cc[N_FREQ], sum_ss[N_FREQ], sum_cs[N_FREQ];
+    float mean, y, t, c, s, dc, ds, aux, tau_c, tau_s, num_c, num_s, den_c, den_s, p, scale;
+    float span, step;
+    uint16_t pos, n_freq;
+
+    if(hrv->n < 3 || hrv->sum_rr < SPAN_MIN){
+        return false;
+    }
+    /* Frequency step = 1 / span: power of a sine spreads over bins adding up to its power,
+     * whatever its frequency is */
+    span = hrv->sum_rr * 0.001f;
+    step = 1 / span;
+    if(step < (HF_MAX - LF_MIN) / (N_FREQ - 1)){
+        step = (HF_MAX - LF_MIN) / (N_FREQ - 1);
+    }
+    n_freq = (HF_MAX - LF_MIN) / step + 1;
+    for(uint16_t k=0; k<n_freq; k++){
+        sum_c[k] = sum_s[k] = sum_cc[k] = sum_ss[k] = sum_cs[k] = 0;
+    }
+    mean = (float)hrv->sum_rr / hrv->n;
+    t = 0;
+    for(uint16_t i=0; i<hrv->n; i++){
+        pos = (hrv->first + i) % HRV_BEATS_MAX;
+        /* Each RR interval is placed at the time of the beat that ends it (s) */
+        t += hrv->rr[pos] * 0.001f;
+        y = hrv->rr[pos] - mean;
+        /* Frequency k from frequency k - 1: rotation by step */
+        c = cosf(2 * M_PI * LF_MIN * t);
+        s = sinf(2 * M_PI * LF_MIN * t);
+        dc = cosf(2 * M_PI * step * t);
+        ds = sinf(2 * M_PI * step * t);
+        for(uint16_t k=0; k<n_freq; k++){
+            sum_c[k] += y * c;
+            sum_s[k] += y * s;
+            sum_cc[k] += c * c;
+            sum_ss[k] += s * s;
+            sum_cs[k] += c * s;
+            aux = c * dc - s * ds;
+            s = s * dc + c * ds;
+            c = aux;
+        }
+    }
+    /* Power of each frequency (ms^2): a sine of amplitude A gives A^2 / 2 */
+    scale = 2.0f / hrv->n * span * step;
+    metrics->lf = metrics->hf = 0;
+    for(uint16_t k=0; k<n_freq; k++){
+        /* Time offset tau: tan(2 w tau) = sum(sin(2wt)) / sum(cos(2wt)) */
+        aux = 0.5f * atan2f(2 * sum_cs[k], sum_cc[k] - sum_ss[k]);
+        tau_c = cosf(aux);
+        tau_s = sinf(aux);
+        num_c = tau_c * sum_c[k] + tau_s * sum_s[k];
+        num_s = tau_c * sum_s[k] - tau_s * sum_c[k];
+        den_c = tau_c * tau_c * sum_cc[k] + 2 * tau_c * tau_s * sum_cs[k] + tau_s * tau_s * sum_ss[k];
+        den_s = tau_c * tau_c * sum_ss[k] - 2 * tau_c * tau_s * sum_cs[k] + tau_s * tau_s * sum_cc[k];
+        p = 0;
+        if(den_c > 0){
+            p += num_c * num_c / den_c;
+        }
+        if(den_s > 0){
+            p += num_s * num_s / den_s;
+        }
+        p *= 0.5f * scale;
+        if(LF_MIN + k * step < LF_HF){
+            metrics->lf += p;
+        }else{
+            metrics->hf += p;
+        }
+    }
+    metrics->lf_hf = (metrics->hf > 0) ? metrics->lf / metrics->hf : 0;
+    return true;
+}
+
+/*==================[end of file]============================================*/
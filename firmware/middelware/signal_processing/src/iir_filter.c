@@ -60,6 +60,10 @@ float hp8_sos_coeff[N_SOS];
 void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
     float f = cut_frec / sample_frec;
     lp_order = order;
+    // Filter restarts from rest
+    for(uint8_t i=0; i<N_DELAY; i++){
+        lp2_delay[i] = lp4_delay[i] = lp6_delay[i] = lp8_delay[i] = 0;
+    }
     switch(lp_order){
         case ORDER_2:
             dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER2_Q);
@@ -85,6 +89,10 @@ void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
 void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
     float f = cut_frec / sample_frec;
     hp_order = order;
+    // Filter restarts from rest
+    for(uint8_t i=0; i<N_DELAY; i++){
+        hp2_delay[i] = hp4_delay[i] = hp6_delay[i] = hp8_delay[i] = 0;
+    }
     switch(hp_order){
         case ORDER_2:
             dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER2_Q);
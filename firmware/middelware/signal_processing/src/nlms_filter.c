@@ -0,0 +1,118 @@
+/**
+ * @file nlms_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Normalized LMS adaptive noise canceller
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "nlms_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define DC_CUT_FREQ     0.5f    /* DC removal cut frequency (Hz) */
+#define POWER_MIN       1e-6f   /* Regularization: no update without references */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void NlmsFilterInit(nlms_filter_t *filter){
+    if(filter->n_refs < 1){
+        filter->n_refs = 1;
+    }
+    if(filter->n_refs > NLMS_REFS_MAX){
+        filter->n_refs = NLMS_REFS_MAX;
+    }
+    if(filter->n_channels < 1){
+        filter->n_channels = 1;
+    }
+    if(filter->n_channels > NLMS_CHANNELS_MAX){
+        filter->n_channels = NLMS_CHANNELS_MAX;
+    }
+    if(filter->taps < 1){
+        filter->taps = 1;
+    }
+    if(filter->taps > NLMS_TAPS_MAX){
+        filter->taps = NLMS_TAPS_MAX;
+    }
+    for(uint8_t c=0; c<NLMS_CHANNELS_MAX; c++){
+        for(uint8_t i=0; i<NLMS_REFS_MAX*NLMS_TAPS_MAX; i++){
+            filter->weights[c][i] = 0;
+        }
+        filter->ch_prev[c] = 0;
+        filter->ch_ac[c] = 0;
+    }
+    for(uint8_t r=0; r<NLMS_REFS_MAX; r++){
+        for(uint8_t i=0; i<2*NLMS_TAPS_MAX; i++){
+            filter->history[r][i] = 0;
+        }
+        filter->ref_prev[r] = 0;
+        filter->ref_ac[r] = 0;
+    }
+    filter->pos = 0;
+    filter->dc_pole = 1 - 2 * M_PI * DC_CUT_FREQ / filter->sample_freq;
+}
+
+void NlmsFilterProcess(nlms_filter_t *filter, const float *reference, const float *input, float *output, uint16_t signal_lenght){
+    uint8_t n_refs = filter->n_refs;
+    uint8_t n_channels = filter->n_channels;
+    uint8_t taps = filter->taps;
+    float pole = filter->dc_pole;
+    const float *u[NLMS_REFS_MAX];
+    float x, ac, dot, power, estimate, gain;
+
+    for(uint16_t i=0; i<signal_lenght; i++){
+        /* References without DC into history, written twice so the last taps samples are
+         * always contiguous */
+        power = POWER_MIN;
+        for(uint8_t r=0; r<n_refs; r++){
+            x = reference[i * n_refs + r];
+            filter->ref_ac[r] = x - filter->ref_prev[r] + pole * filter->ref_ac[r];
+            filter->ref_prev[r] = x;
+            filter->history[r][filter->pos] = filter->ref_ac[r];
+            filter->history[r][filter->pos + taps] = filter->ref_ac[r];
+        }
+        if(++filter->pos == taps){
+            filter->pos = 0;
+        }
+        for(uint8_t r=0; r<n_refs; r++){
+            u[r] = &filter->history[r][filter->pos];
+            dsps_dotprod_f32(u[r], u[r], &dot, taps);
+            power += dot;
+        }
+        for(uint8_t c=0; c<n_channels; c++){
+            float *w = filter->weights[c];
+            x = input[i * n_channels + c];
+            ac = x - filter->ch_prev[c] + pole * filter->ch_ac[c];
+            filter->ch_prev[c] = x;
+            filter->ch_ac[c] = ac;
+            /* Noise estimate, removed from the channel (keeping its DC) */
+            estimate = 0;
+            for(uint8_t r=0; r<n_refs; r++){
+                dsps_dotprod_f32(&w[r * taps], u[r], &dot, taps);
+                estimate += dot;
+            }
+            output[i * n_channels + c] = x - estimate;
+            /* Coefficients update */
+            gain = filter->mu * (ac - estimate) / power;
+            for(uint8_t r=0; r<n_refs; r++){
+                for(uint8_t k=0; k<taps; k++){
+                    w[r * taps + k] += gain * u[r][k];
+                }
+            }
+        }
+    }
+}
+
+/*==================[end of file]============================================*/
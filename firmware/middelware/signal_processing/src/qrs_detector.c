@@ -0,0 +1,228 @@
+/**
+ * @file qrs_detector.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Streaming QRS detector (Pan-Tompkins)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include "qrs_detector.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define BP_LOW_FREQ     5.0f    /* Band-pass: hi pass cut-off frequency (Hz) */
+#define BP_HIGH_FREQ    15.0f   /* Band-pass: low pass cut-off frequency (Hz) */
+#define BUTTER_Q        0.7071f /* 2nd order Butterworth */
+#define MWI_TIME        0.15f   /* Integration window (s) */
+#define REFRACTORY_TIME 0.2f    /* Minimum time between beats (s) */
+#define LEARN_TIME      2.0f    /* Learning phase (s) */
+#define RR_MAX_TIME     3.0f    /* Longer RR intervals (lead off, noise) are not averaged (s) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Biquad filter, same form as dsps_biquad_f32()
+ */
+static float Biquad(const float *coeffs, float *w, float x){
+    float d = x - coeffs[3] * w[0] - coeffs[4] * w[1];
+    float y = coeffs[0] * d + coeffs[1] * w[0] + coeffs[2] * w[1];
+    w[1] = w[0];
+    w[0] = d;
+    return y;
+}
+
+/**
+ * @brief Registers a beat at time t
+ *
+ * @return RR interval (ms), 0 for the first beat
+ */
+static uint16_t QrsBeat(qrs_detector_t *detector, uint32_t t){
+    uint32_t rr = t - detector->last_beat;
+    uint16_t rr_ms = 0;
+
+    if(!detector->first_beat){
+        rr_ms = rr * 1000 / detector->sample_freq;
+        if(rr < RR_MAX_TIME * detector->sample_freq){
+            /* Running sum of the last QRS_RR_AVG intervals */
+            detector->rr_sum += rr - detector->rr[detector->rr_pos];
+            detector->rr[detector->rr_pos] = rr;
+            detector->rr_pos = (detector->rr_pos + 1) % QRS_RR_AVG;
+            if(detector->n_rr < QRS_RR_AVG){
+                detector->n_rr++;
+            }
+            detector->rr_limit = detector->rr_sum * 166 / (100 * detector->n_rr);
+        }
+    }
+    detector->first_beat = false;
+    detector->last_beat = t;
+    detector->sb_peak = 0;
+    return rr_ms;
+}
+
+/*==================[external functions definition]==========================*/
+void QrsDetectorInit(qrs_detector_t *detector){
+    dsps_biquad_gen_lpf_f32(detector->lp_coeffs, BP_HIGH_FREQ / detector->sample_freq, BUTTER_Q);
+    dsps_biquad_gen_hpf_f32(detector->hp_coeffs, BP_LOW_FREQ / detector->sample_freq, BUTTER_Q);
+    detector->lp_w[0] = detector->lp_w[1] = 0;
+    detector->hp_w[0] = detector->hp_w[1] = 0;
+    for(uint8_t i=0; i<4; i++){
+        detector->deriv[i] = 0;
+    }
+    detector->mwi_len = MWI_TIME * detector->sample_freq;
+    if(detector->mwi_len > QRS_MWI_MAX){
+        detector->mwi_len = QRS_MWI_MAX;
+    }
+    if(detector->mwi_len < 1){
+        detector->mwi_len = 1;
+    }
+    for(uint16_t i=0; i<QRS_MWI_MAX; i++){
+        detector->mwi[i] = 0;
+    }
+    detector->mwi_sum = 0;
+    detector->mwi_pos = 0;
+    detector->hump_max = 0;
+    detector->trough = 0;
+    detector->rising = false;
+    detector->x_max = 0;
+    detector->x_time = 0;
+    detector->spk = detector->npk = detector->threshold = 0;
+    detector->sb_peak = 0;
+    detector->sb_time = 0;
+    detector->time = 0;
+    detector->last_beat = 0;
+    detector->refractory = REFRACTORY_TIME * detector->sample_freq;
+    detector->learn = LEARN_TIME * detector->sample_freq;
+    detector->learn_max = detector->learn_sum = 0;
+    for(uint8_t i=0; i<QRS_RR_AVG; i++){
+        detector->rr[i] = 0;
+    }
+    detector->rr_sum = 0;
+    detector->rr_pos = 0;
+    detector->n_rr = 0;
+    detector->rr_limit = 0;
+    detector->first_beat = true;
+}
+
+uint8_t QrsDetectorProcess(qrs_detector_t *detector, const float *signal, uint16_t signal_lenght, uint16_t *rr_ms){
+    float *d = detector->deriv;
+    float x, y, peak;
+    uint32_t t;
+    uint8_t beats = 0;
+    uint16_t rr;
+
+    for(uint16_t i=0; i<signal_lenght; i++){
+        /* Band-pass */
+        x = Biquad(detector->lp_coeffs, detector->lp_w, signal[i]);
+        x = Biquad(detector->hp_coeffs, detector->hp_w, x);
+        /* Five point derivative and squaring */
+        y = 2 * x + d[0] - d[2] - 2 * d[3];
+        d[3] = d[2];
+        d[2] = d[1];
+        d[1] = d[0];
+        d[0] = x;
+        y = y * y;
+        /* Moving window integration (running sum, recalculated once per window to avoid drift) */
+        detector->mwi_sum += y - detector->mwi[detector->mwi_pos];
+        detector->mwi[detector->mwi_pos] = y;
+        if(++detector->mwi_pos == detector->mwi_len){
+            detector->mwi_pos = 0;
+            detector->mwi_sum = 0;
+            for(uint16_t k=0; k<detector->mwi_len; k++){
+                detector->mwi_sum += detector->mwi[k];
+            }
+        }
+        y = detector->mwi_sum;
+        /* Beat position: highest band-passed sample */
+        if(x < 0){
+            x = -x;
+        }
+        if(x > detector->x_max){
+            detector->x_max = x;
+            detector->x_time = detector->time;
+        }
+        detector->time++;
+
+        if(detector->time <= detector->learn){
+            /* Learning phase: initial signal and noise levels */
+            if(y > detector->learn_max){
+                detector->learn_max = y;
+            }
+            detector->learn_sum += y;
+            if(detector->time == detector->learn){
+                detector->spk = detector->learn_max / 3;
+                detector->npk = detector->learn_sum / (2 * detector->learn);
+                detector->threshold = detector->npk + 0.25f * (detector->spk - detector->npk);
+                /* Humps start after learning: a beat can't be placed in the learning phase */
+                detector->trough = y;
+                detector->x_max = 0;
+            }
+            continue;
+        }
+        /* Humps: start when the signal doubles its minimum, end when it falls to half its maximum */
+        if(!detector->rising){
+            if(y < detector->trough){
+                detector->trough = y;
+            }else if(y > 2 * detector->trough){
+                detector->rising = true;
+                detector->hump_max = y;
+            }
+        }else if(y > detector->hump_max){
+            detector->hump_max = y;
+        }else if(y < 0.5f * detector->hump_max){
+            peak = detector->hump_max;
+            t = detector->x_time;
+            detector->rising = false;
+            detector->trough = y;
+            detector->x_max = 0;
+            if(detector->first_beat || t - detector->last_beat >= detector->refractory){
+                if(peak > detector->threshold){
+                    rr = QrsBeat(detector, t);
+                    if(rr_ms != NULL){
+                        rr_ms[beats] = rr;
+                    }
+                    beats++;
+                    detector->spk = 0.125f * peak + 0.875f * detector->spk;
+                }else{
+                    detector->npk = 0.125f * peak + 0.875f * detector->npk;
+                    if(peak > detector->sb_peak){
+                        detector->sb_peak = peak;
+                        detector->sb_time = t;
+                    }
+                }
+                detector->threshold = detector->npk + 0.25f * (detector->spk - detector->npk);
+            }
+        }
+        /* Search back: missed beat, take highest hump above second threshold */
+        if(detector->n_rr > 0 && detector->time - detector->last_beat > detector->rr_limit &&
+           detector->sb_peak > 0.5f * detector->threshold){
+            peak = detector->sb_peak;
+            rr = QrsBeat(detector, detector->sb_time);
+            if(rr_ms != NULL){
+                rr_ms[beats] = rr;
+            }
+            beats++;
+            detector->spk = 0.25f * peak + 0.75f * detector->spk;
+            detector->threshold = detector->npk + 0.25f * (detector->spk - detector->npk);
+        }
+    }
+    return beats;
+}
+
+uint16_t QrsDetectorHeartRate(qrs_detector_t *detector){
+    if(detector->n_rr == 0){
+        return 0;
+    }
+    return 60.0f * detector->sample_freq * detector->n_rr / detector->rr_sum;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,220 @@
+/**
+ * @file resampler.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief CIC + FIR decimator and polyphase resampler
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "resampler.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define DESIGN_POINTS   256     /* Frequency points used to design the compensation filter */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Blackman window value for tap n of a len taps filter
+ */
+static float Blackman(uint16_t n, uint16_t len){
+    if(len < 2){
+        return 1;
+    }
+    float x = 2 * M_PI * n / (len - 1);
+    return 0.42f - 0.5f * cosf(x) + 0.08f * cosf(2 * x);
+}
+
+/**
+ * @brief CIC magnitude response at frequency f (cycles per CIC output sample)
+ */
+static float CicResponse(float f, uint16_t ratio, uint8_t order){
+    if(f == 0){
+        return 1;
+    }
+    float h = sinf(M_PI * f) / (ratio * sinf(M_PI * f / ratio));
+    return powf(fabsf(h), order);
+}
+
+/**
+ * @brief Compensation FIR design (frequency sampling + window). Passband response is the
+ * inverse of the CIC response, then it fades to zero before the output Nyquist frequency is
+ * aliased into the passband.
+ */
+static void CompensationDesign(decimator_t *decimator){
+    uint8_t taps = decimator->fir_taps;
+    float f_pass = decimator->passband / decimator->fir_ratio;
+    float f_stop = (1.0f - decimator->passband) / decimator->fir_ratio;
+    float center = (taps - 1) / 2.0f;
+    float f, d, sum = 0;
+
+    if(f_stop > 0.5f){
+        f_stop = 0.5f;
+    }
+    for(uint8_t n=0; n<taps; n++){
+        decimator->coeffs[n] = 0;
+    }
+    for(uint16_t k=0; k<DESIGN_POINTS; k++){
+        f = 0.5f * k / DESIGN_POINTS;
+        if(f <= f_pass){
+            d = 1 / CicResponse(f, decimator->cic_ratio, decimator->cic_order);
+        }else if(f < f_stop){
+            d = 1 / CicResponse(f_pass, decimator->cic_ratio, decimator->cic_order);
+            d *= 0.5f * (1 + cosf(M_PI * (f - f_pass) / (f_stop - f_pass)));
+        }else{
+            break;
+        }
+        if(k > 0){
+            d *= 2;     /* negative frequencies */
+        }
+        for(uint8_t n=0; n<taps; n++){
+            decimator->coeffs[n] += d * cosf(2 * M_PI * f * (n - center));
+        }
+    }
+    for(uint8_t n=0; n<taps; n++){
+        decimator->coeffs[n] *= Blackman(n, taps);
+        sum += decimator->coeffs[n];
+    }
+    /* Unity DC gain */
+    for(uint8_t n=0; n<taps; n++){
+        decimator->coeffs[n] /= sum;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+void DecimatorInit(decimator_t *decimator){
+    if(decimator->cic_ratio < 1){
+        decimator->cic_ratio = 1;
+    }
+    if(decimator->cic_order < 1){
+        decimator->cic_order = 1;
+    }
+    if(decimator->cic_order > CIC_ORDER_MAX){
+        decimator->cic_order = CIC_ORDER_MAX;
+    }
+    if(decimator->fir_ratio < 1){
+        decimator->fir_ratio = 1;
+    }
+    if(decimator->fir_ratio > FIR_RATIO_MAX){
+        decimator->fir_ratio = FIR_RATIO_MAX;
+    }
+    if(decimator->fir_taps < 1){
+        decimator->fir_taps = 1;
+    }
+    if(decimator->fir_taps > DECIMATOR_TAPS_MAX){
+        decimator->fir_taps = DECIMATOR_TAPS_MAX;
+    }
+    for(uint8_t i=0; i<CIC_ORDER_MAX; i++){
+        decimator->integ[i] = 0;
+        decimator->comb[i] = 0;
+    }
+    decimator->count = 0;
+    decimator->n_cic_out = 0;
+    decimator->cic_gain = 1.0f / powf(decimator->cic_ratio, decimator->cic_order);
+    CompensationDesign(decimator);
+    dsps_fird_init_f32(&decimator->fir, decimator->coeffs, decimator->delay, decimator->fir_taps, decimator->fir_ratio);
+}
+
+uint16_t DecimatorProcess(decimator_t *decimator, const int16_t *input, float *output, uint16_t signal_lenght){
+    uint8_t order = decimator->cic_order;
+    uint16_t n_out = 0;
+    uint32_t acc, prev;
+
+    for(uint16_t i=0; i<signal_lenght; i++){
+        /* Integrators (at input rate) */
+        acc = (uint32_t)(int32_t)input[i];
+        for(uint8_t k=0; k<order; k++){
+            decimator->integ[k] += acc;
+            acc = decimator->integ[k];
+        }
+        if(++decimator->count < decimator->cic_ratio){
+            continue;
+        }
+        decimator->count = 0;
+        /* Combs (at CIC output rate) */
+        for(uint8_t k=0; k<order; k++){
+            prev = decimator->comb[k];
+            decimator->comb[k] = acc;
+            acc -= prev;
+        }
+        decimator->cic_out[decimator->n_cic_out++] = (int32_t)acc * decimator->cic_gain;
+        /* Compensation FIR (at output rate) */
+        if(decimator->n_cic_out == decimator->fir_ratio){
+            decimator->n_cic_out = 0;
+            n_out += dsps_fird_f32(&decimator->fir, decimator->cic_out, &output[n_out], 1);
+        }
+    }
+    return n_out;
+}
+
+void ResamplerInit(resampler_t *resampler){
+    uint16_t len, n;
+    float fc, x, center;
+
+    if(resampler->up < 1){
+        resampler->up = 1;
+    }
+    if(resampler->up > RESAMPLER_UP_MAX){
+        resampler->up = RESAMPLER_UP_MAX;
+    }
+    if(resampler->down < 1){
+        resampler->down = 1;
+    }
+    if(resampler->taps < 1){
+        resampler->taps = 1;
+    }
+    if(resampler->taps > RESAMPLER_TAPS_MAX){
+        resampler->taps = RESAMPLER_TAPS_MAX;
+    }
+    /* Prototype low pass filter at up * input rate (windowed sinc, gain = up) */
+    len = resampler->up * resampler->taps;
+    center = (len - 1) / 2.0f;
+    fc = resampler->passband * 0.5f / ((resampler->up > resampler->down) ? resampler->up : resampler->down);
+    for(uint8_t p=0; p<resampler->up; p++){
+        for(uint8_t k=0; k<resampler->taps; k++){
+            n = p + k * resampler->up;
+            x = n - center;
+            float h = (x == 0) ? 2 * fc : sinf(2 * M_PI * fc * x) / (M_PI * x);
+            /* Taps of each phase are stored from oldest to newest input sample */
+            resampler->coeffs[p * resampler->taps + (resampler->taps - 1 - k)] = h * Blackman(n, len) * resampler->up;
+        }
+    }
+    for(uint8_t i=0; i<2*RESAMPLER_TAPS_MAX; i++){
+        resampler->history[i] = 0;
+    }
+    resampler->pos = 0;
+    resampler->phase = 0;
+}
+
+uint16_t ResamplerProcess(resampler_t *resampler, const float *input, float *output, uint16_t signal_lenght){
+    uint8_t taps = resampler->taps;
+    uint16_t n_out = 0;
+
+    for(uint16_t i=0; i<signal_lenght; i++){
+        /* Written twice so the last taps samples are always contiguous */
+        resampler->history[resampler->pos] = input[i];
+        resampler->history[resampler->pos + taps] = input[i];
+        if(++resampler->pos == taps){
+            resampler->pos = 0;
+        }
+        /* Output samples between this input sample and the next one */
+        while(resampler->phase < resampler->up){
+            dsps_dotprod_f32(&resampler->coeffs[resampler->phase * taps], &resampler->history[resampler->pos], &output[n_out++], taps);
+            resampler->phase += resampler->down;
+        }
+        resampler->phase -= resampler->up;
+    }
+    return n_out;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,154 @@
+/**
+ * @file running_median.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Running median / percentile filter
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "running_median.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Heap array and size of low (true) or high (false) heap
+ */
+static uint8_t * Heap(running_median_t *filter, bool low, uint8_t **size){
+    *size = low ? &filter->n_low : &filter->n_high;
+    return low ? filter->low : filter->high;
+}
+
+/**
+ * @brief Sample a goes above sample b in the heap (greater in low, lower in high)
+ */
+static bool Above(running_median_t *filter, bool low, uint8_t a, uint8_t b){
+    return low ? (filter->value[a] > filter->value[b]) : (filter->value[a] < filter->value[b]);
+}
+
+/**
+ * @brief Puts sample in position i of the heap
+ */
+static void Place(running_median_t *filter, uint8_t *heap, uint8_t i, uint8_t sample){
+    heap[i] = sample;
+    filter->where[sample] = i;
+}
+
+/**
+ * @brief Moves the sample in position i up or down until heap order is restored
+ */
+static void Sift(running_median_t *filter, bool low, uint8_t i){
+    uint8_t *size;
+    uint8_t *heap = Heap(filter, low, &size);
+    uint8_t sample = heap[i];
+    uint8_t parent, child;
+
+    /* Up */
+    while(i > 0){
+        parent = (i - 1) / 2;
+        if(!Above(filter, low, sample, heap[parent])){
+            break;
+        }
+        Place(filter, heap, i, heap[parent]);
+        i = parent;
+    }
+    /* Down */
+    while((child = 2 * i + 1) < *size){
+        if(child + 1 < *size && Above(filter, low, heap[child + 1], heap[child])){
+            child++;
+        }
+        if(!Above(filter, low, heap[child], sample)){
+            break;
+        }
+        Place(filter, heap, i, heap[child]);
+        i = child;
+    }
+    Place(filter, heap, i, sample);
+}
+
+static void Push(running_median_t *filter, bool low, uint8_t sample){
+    uint8_t *size;
+    uint8_t *heap = Heap(filter, low, &size);
+    filter->in_low[sample] = low;
+    Place(filter, heap, (*size)++, sample);
+    Sift(filter, low, *size - 1);
+}
+
+/**
+ * @brief Removes the sample in position i of the heap, returns it
+ */
+static uint8_t Remove(running_median_t *filter, bool low, uint8_t i){
+    uint8_t *size;
+    uint8_t *heap = Heap(filter, low, &size);
+    uint8_t sample = heap[i];
+    (*size)--;
+    if(i < *size){
+        Place(filter, heap, i, heap[*size]);
+        Sift(filter, low, i);
+    }
+    return sample;
+}
+
+/*==================[external functions definition]==========================*/
+void RunningMedianInit(running_median_t *filter){
+    if(filter->window < 1){
+        filter->window = 1;
+    }
+    if(filter->window > RUNNING_MEDIAN_MAX){
+        filter->window = RUNNING_MEDIAN_MAX;
+    }
+    if(filter->percentile > 100){
+        filter->percentile = 100;
+    }
+    filter->n_low = 0;
+    filter->n_high = 0;
+    filter->pos = 0;
+}
+
+float RunningMedianUpdate(running_median_t *filter, float sample){
+    uint8_t slot = filter->pos;
+    uint8_t count, rank;
+
+    /* Oldest sample leaves the window */
+    if(filter->n_low + filter->n_high == filter->window){
+        Remove(filter, filter->in_low[slot], filter->where[slot]);
+    }
+    filter->value[slot] = sample;
+    if(++filter->pos == filter->window){
+        filter->pos = 0;
+    }
+    if(filter->n_low > 0 && sample <= filter->value[filter->low[0]]){
+        Push(filter, true, slot);
+    }else{
+        Push(filter, false, slot);
+    }
+    /* Lowest rank samples in low: percentile is the top of low */
+    count = filter->n_low + filter->n_high;
+    rank = ((uint16_t)filter->percentile * (count - 1) + 50) / 100 + 1;
+    while(filter->n_low > rank){
+        Push(filter, false, Remove(filter, true, 0));
+    }
+    while(filter->n_low < rank){
+        Push(filter, true, Remove(filter, false, 0));
+    }
+    return filter->value[filter->low[0]];
+}
+
+void RunningMedianProcess(running_median_t *filter, const float *input, float *output, uint16_t signal_lenght){
+    for(uint16_t i=0; i<signal_lenght; i++){
+        output[i] = RunningMedianUpdate(filter, input[i]);
+    }
+}
+
+/*==================[end of file]============================================*/
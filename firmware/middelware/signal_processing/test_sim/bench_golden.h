@@ -0,0 +1,33 @@
+/* Generated by obj/bench_signal_processing --golden: {name, param, {mean, rms, out[n/2], out[n-1]}} */
+static const bench_golden_t golden[] = {
+    {"fft_magnitude", 64, {10.8179798, 39.5909767, 0.653069675, 0.255435497}},
+    {"fft_magnitude", 128, {5.39942789, 24.8003578, 0.934626877, 0.215261534}},
+    {"fft_magnitude", 256, {7.75054502, 22.1166458, 0.55897367, 0.0746412501}},
+    {"fft_magnitude", 512, {3.26735592, 13.4425077, 0.406723529, 0.0281744748}},
+    {"fft_magnitude", 1024, {2.17004967, 9.8987751, 0.407054603, 0.0156403277}},
+    {"fft_magnitude", 2048, {1.08512342, 6.99906826, 0.407251209, 0.0156173892}},
+    {"low_pass_filter", 2, {92.9529724, 95.8783417, 75.4188309, 75.701889}},
+    {"low_pass_filter", 4, {92.932991, 95.9049149, 75.5678635, 77.1248016}},
+    {"low_pass_filter", 6, {92.9113617, 95.8997345, 78.0604782, 78.9758148}},
+    {"low_pass_filter", 8, {92.8892059, 95.891777, 78.5634308, 77.7620544}},
+    {"hi_pass_filter", 2, {-0.0525054932, 25.1022243, -15.3125, -16.75}},
+    {"hi_pass_filter", 4, {-0.106821194, 25.0572414, -10.5800781, -12.1464844}},
+    {"hi_pass_filter", 6, {-0.139207482, 25.0265636, -2.38134766, -3.99951172}},
+    {"hi_pass_filter", 8, {-0.13138555, 24.9949532, 7.14355469, 5.18994141}},
+    {"dsps_biquad_f32", 2, {92.95298, 95.878067, 75.4191971, 75.7024384}},
+    {"dsps_fird_f32", 32, {92.717804, 93.5160828, 76.3125, 78.53125}},
+    {"dsps_dotprod_f32", 16, {122397.562, 123361.18, 109194, 99644}},
+    {"dsps_mul_f32", 0, {9222.5, 11417.1992, 5776, 5625}},
+    {"dsps_wind_hann_f32", 1024, {0.499511719, 0.612073362, 0.999997616, 0}},
+    {"dsps_fft2r_fc32", 1024, {38, 2172.99805, 8, 0}},
+    {"dsps_dct_f32", 64, {91.5151215, 757.872803, 5923, 0.766869545}},
+    {"qrs_detector", 0, {950.857117, 986.751099, 1024, 1024}},
+    {"decimator", 10, {2415.36182, 2419.54688, 2341.13208, 2331.58618}},
+    {"resampler", 3, {92.823288, 95.9653702, 73.5816422, 69.9433899}},
+    {"nlms_filter", 4, {64993.1953, 66701.9766, 50327.3242, 79787.3828}},
+    {"running_median", 31, {90.9814453, 91.388031, 76, 76}},
+    {"ecg_codec", 0, {113.795883, 157.867477, 224, 224}},
+    {"ecg_codec", 1, {106.336403, 145.500046, 128, 128}},
+    {"spo2_algorithm", 100, {42.75, 60.1311073, 75, 1}},
+    {"check_for_beat", 0, {2104.48438, 2400.45874, 2115, 4094}},
+};
@@ -0,0 +1,496 @@
+/**
+ * Host benchmark of the signal processing path: middelware wrappers (iir_filter, fft and the
+ * streaming modules), the esp-dsp kernels they use and the MAX3010X SpO2 / heart rate algorithms.
+ *
+ * Each case runs over the bundled ECG beat (repeated, 250 Hz) or a synthetic PPG (25 Hz). The
+ * best time of several runs is reported as JSON (ns per sample and Msamples/s), and a signature
+ * of the output of the first run (mean, RMS and two samples) is checked against bench_golden.h.
+ *
+ *   make bench                                             runs the benchmark
+ *   obj/bench_signal_processing --golden > bench_golden.h  regenerates the golden outputs
+ *
+ * Times are only comparable on the same machine and compiler flags.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "iir_filter.h"
+#include "fft.h"
+#include "qrs_detector.h"
+#include "resampler.h"
+#include "nlms_filter.h"
+#include "running_median.h"
+#include "ecg_codec.h"
+#include "esp_dsp.h"
+#include "spo2_algorithm.h"
+#include "heartRate.h"
+
+#include "ecg_data.h"
+
+#define ECG_FS          250
+#define PPG_FS          FreqS       /* spo2_algorithm sample frequency (25 Hz) */
+#define N               4096        /* Samples of the long signals */
+#define OVERSAMPLING    10          /* Decimator input: ECG at 2500 Hz */
+#define MIN_RUNS        5
+#define MIN_TIME        0.1         /* Minimum time per case (s) */
+#define GOLDEN_TOL      1e-3f       /* Relative to the output RMS */
+
+typedef struct {
+    const char *name;
+    int param;
+    float signature[4];
+} bench_golden_t;
+
+#include "bench_golden.h"
+
+/**
+ * Benchmark case: setup() is not timed, run() is. run() leaves its output in out / n_out.
+ */
+typedef struct {
+    const char *name;
+    int param;                      /* Size, order, mode... */
+    uint32_t samples;               /* Input samples processed by run() */
+    void (*setup)(int param);
+    void (*run)(int param);
+} bench_t;
+
+/*==================[signals]================================================*/
+static float ecg_long[N];
+static int16_t ecg_int[N];
+static int16_t ecg_oversampled[N * OVERSAMPLING];
+static float acc[N * 3];
+static float ppg[N * 2];
+static uint32_t ppg_ir[N];
+static uint32_t ppg_red[N];
+
+static float in[2 * N];
+static float out[2 * N];
+static uint32_t n_out;
+
+/**
+ * Pulse waveform (1.2 Hz, 72 bpm) with its harmonics
+ */
+static float Pulse(float t)
+{
+    return sinf(2 * M_PI * 1.2f * t) + 0.4f * sinf(2 * M_PI * 2.4f * t + 1) + 0.15f * sinf(2 * M_PI * 3.6f * t + 2);
+}
+
+static void SignalsInit(void)
+{
+    for (int i = 0; i < N; i++) {
+        ecg_long[i] = ecg[i % ECG_LENGHT];
+        ecg_int[i] = 8 * ecg[i % ECG_LENGHT];
+    }
+    /* Oversampled ECG with a deterministic dither, as 12 bits ADC values */
+    for (int i = 0; i < N * OVERSAMPLING; i++) {
+        ecg_oversampled[i] = 2048 + 4 * ecg[(i / OVERSAMPLING) % ECG_LENGHT] + (i * 7919) % 5 - 2;
+    }
+    /* PPG with motion artifact, and the accelerometer that measures it */
+    for (int i = 0; i < N; i++) {
+        float t = (float)i / PPG_FS;
+        for (int r = 0; r < 3; r++) {
+            acc[i * 3 + r] = (r == 2 ? 16384 : 0) + 800 * sinf(2 * M_PI * 1.8f * t + r);
+        }
+        float m = acc[i * 3] + 0.5f * acc[i * 3 + 1];
+        ppg[i * 2] = 50000 + 200 * Pulse(t) + 0.6f * m;
+        ppg[i * 2 + 1] = 80000 + 300 * Pulse(t) + 0.9f * m;
+        /* checkForBeat() takes 16 bits samples */
+        ppg_red[i] = 25000 + 120 * Pulse(t);
+        ppg_ir[i] = 30000 + 200 * Pulse(t);
+    }
+}
+
+/*==================[middelware wrappers]====================================*/
+static void FftSetup(int size)
+{
+    memcpy(in, ecg_long, size * sizeof(float));
+}
+
+static void FftRun(int size)
+{
+    FFTMagnitude(in, out, size);
+    n_out = size / 2;
+}
+
+static void LowPassSetup(int order)
+{
+    LowPassInit(ECG_FS, 40, order);
+}
+
+static void LowPassRun(int order)
+{
+    LowPassFilter(ecg_long, out, N);
+    n_out = N;
+}
+
+static void HiPassSetup(int order)
+{
+    HiPassInit(ECG_FS, 0.5f, order);
+}
+
+static void HiPassRun(int order)
+{
+    HiPassFilter(ecg_long, out, N);
+    n_out = N;
+}
+
+/*==================[esp-dsp kernels]========================================*/
+static float coeffs[64];
+static float delay[64];
+static float w[2];
+static fir_f32_t fir;
+
+static void BiquadSetup(int param)
+{
+    dsps_biquad_gen_lpf_f32(coeffs, 40.0f / ECG_FS, 0.707f);
+    w[0] = w[1] = 0;
+}
+
+static void BiquadRun(int param)
+{
+    dsps_biquad_f32(ecg_long, out, N, coeffs, w);
+    n_out = N;
+}
+
+static void FirdSetup(int taps)
+{
+    for (int i = 0; i < taps; i++) {
+        coeffs[i] = 1.0f / taps;
+    }
+    dsps_fird_init_f32(&fir, coeffs, delay, taps, 4);
+}
+
+static void FirdRun(int taps)
+{
+    n_out = dsps_fird_f32(&fir, ecg_long, out, N / 4);
+}
+
+static void DotprodSetup(int len)
+{
+}
+
+static void DotprodRun(int len)
+{
+    n_out = 0;
+    for (int i = 0; i + len <= N; i += len) {
+        dsps_dotprod_f32(&ecg_long[i], ecg_long, &out[n_out++], len);
+    }
+}
+
+static void MulSetup(int param)
+{
+}
+
+static void MulRun(int param)
+{
+    dsps_mul_f32(ecg_long, ecg_long, out, N, 1, 1, 1);
+    n_out = N;
+}
+
+static void HannSetup(int len)
+{
+}
+
+static void HannRun(int len)
+{
+    dsps_wind_hann_f32(out, len);
+    n_out = len;
+}
+
+static void Fft2rSetup(int size)
+{
+    for (int i = 0; i < size; i++) {
+        in[2 * i] = ecg_long[i];
+        in[2 * i + 1] = 0;
+    }
+}
+
+static void Fft2rRun(int size)
+{
+    dsps_fft2r_fc32(in, size);
+    dsps_bit_rev_fc32(in, size);
+    memcpy(out, in, 2 * size * sizeof(float));
+    n_out = 2 * size;
+}
+
+static void DctSetup(int len)
+{
+}
+
+static void DctRun(int len)
+{
+    /* Blocks of len samples, as ecg_codec (dsps_dct_f32 needs 2 * len) */
+    for (int i = 0; i + len <= N; i += len) {
+        memcpy(in, &ecg_long[i], len * sizeof(float));
+        dsps_dct_f32(in, len);
+        memcpy(&out[i], in, len * sizeof(float));
+    }
+    n_out = N;
+}
+
+/*==================[streaming modules]======================================*/
+static qrs_detector_t qrs;
+static decimator_t decimator;
+static resampler_t resampler;
+static nlms_filter_t nlms;
+static running_median_t median;
+static ecg_codec_t codec;
+
+static void QrsSetup(int param)
+{
+    qrs.sample_freq = ECG_FS;
+    QrsDetectorInit(&qrs);
+}
+
+static void QrsRun(int param)
+{
+    uint16_t rr[16 * 5 / ECG_FS + 2];
+    n_out = 0;
+    for (int i = 0; i < N; i += 16) {
+        uint8_t beats = QrsDetectorProcess(&qrs, &ecg_long[i], 16, rr);
+        for (int k = 0; k < beats; k++) {
+            out[n_out++] = rr[k];
+        }
+    }
+}
+
+static void DecimatorSetup(int param)
+{
+    decimator = (decimator_t){.cic_ratio = OVERSAMPLING / 2, .cic_order = 3, .fir_ratio = 2, .fir_taps = 32, .passband = 0.4f};
+    DecimatorInit(&decimator);
+}
+
+static void DecimatorRun(int param)
+{
+    n_out = DecimatorProcess(&decimator, ecg_oversampled, out, N * OVERSAMPLING);
+}
+
+static void ResamplerSetup(int up)
+{
+    resampler = (resampler_t){.up = up, .down = 2, .taps = 16, .passband = 0.9f};
+    ResamplerInit(&resampler);
+}
+
+static void ResamplerRun(int up)
+{
+    n_out = ResamplerProcess(&resampler, ecg_long, out, N);
+}
+
+static void NlmsSetup(int taps)
+{
+    nlms = (nlms_filter_t){.sample_freq = PPG_FS, .n_refs = 3, .n_channels = 2, .taps = taps, .mu = 0.01f};
+    NlmsFilterInit(&nlms);
+}
+
+static void NlmsRun(int taps)
+{
+    NlmsFilterProcess(&nlms, acc, ppg, out, N);
+    n_out = 2 * N;
+}
+
+static void MedianSetup(int window)
+{
+    median = (running_median_t){.window = window, .percentile = 50};
+    RunningMedianInit(&median);
+}
+
+static void MedianRun(int window)
+{
+    RunningMedianProcess(&median, ecg_long, out, N);
+    n_out = N;
+}
+
+static void CodecSetup(int mode)
+{
+    codec = (ecg_codec_t){.mode = mode, .block_lenght = 64, .prd = 1};
+    EcgCodecInit(&codec);
+}
+
+static void CodecRun(int mode)
+{
+    static uint8_t data[ECG_CODEC_OUT_MAX(N)];
+    uint16_t size = EcgCodecEncode(&codec, ecg_int, N, data);
+    size += EcgCodecFlush(&codec, &data[size]);
+    /* Output: the encoded size, then the data bytes */
+    out[0] = size;
+    for (int i = 0; i < size && i + 1 < 2 * N; i++) {
+        out[i + 1] = data[i];
+    }
+    n_out = (size + 1 < 2 * N) ? size + 1 : 2 * N;
+}
+
+/*==================[MAX3010X algorithms]====================================*/
+static void Spo2Setup(int param)
+{
+}
+
+static void Spo2Run(int param)
+{
+    int32_t spo2, heart_rate;
+    int8_t spo2_valid, hr_valid;
+    maxim_heart_rate_and_oxygen_saturation(ppg_ir, BUFFER_SIZE, ppg_red, &spo2, &spo2_valid, &heart_rate, &hr_valid);
+    out[0] = spo2;
+    out[1] = spo2_valid;
+    out[2] = heart_rate;
+    out[3] = hr_valid;
+    n_out = 4;
+}
+
+static void BeatSetup(int param)
+{
+}
+
+static void BeatRun(int param)
+{
+    /* checkForBeat() keeps its state in static variables: only the first run is repeatable */
+    n_out = 0;
+    for (int i = 0; i < N; i++) {
+        if (checkForBeat(ppg_ir[i])) {
+            out[n_out++] = i;
+        }
+    }
+    if (n_out == 0) {
+        out[n_out++] = -1;
+    }
+}
+
+/*==================[benchmark cases]========================================*/
+static const bench_t benchs[] = {
+    /* FFTMagnitude() sizes: 64 to MAX_SIGNAL_LENGHT */
+    {"fft_magnitude", 64, 64, FftSetup, FftRun},
+    {"fft_magnitude", 128, 128, FftSetup, FftRun},
+    {"fft_magnitude", 256, 256, FftSetup, FftRun},
+    {"fft_magnitude", 512, 512, FftSetup, FftRun},
+    {"fft_magnitude", 1024, 1024, FftSetup, FftRun},
+    {"fft_magnitude", 2048, 2048, FftSetup, FftRun},
+    {"low_pass_filter", ORDER_2, N, LowPassSetup, LowPassRun},
+    {"low_pass_filter", ORDER_4, N, LowPassSetup, LowPassRun},
+    {"low_pass_filter", ORDER_6, N, LowPassSetup, LowPassRun},
+    {"low_pass_filter", ORDER_8, N, LowPassSetup, LowPassRun},
+    {"hi_pass_filter", ORDER_2, N, HiPassSetup, HiPassRun},
+    {"hi_pass_filter", ORDER_4, N, HiPassSetup, HiPassRun},
+    {"hi_pass_filter", ORDER_6, N, HiPassSetup, HiPassRun},
+    {"hi_pass_filter", ORDER_8, N, HiPassSetup, HiPassRun},
+    {"dsps_biquad_f32", 2, N, BiquadSetup, BiquadRun},
+    {"dsps_fird_f32", 32, N, FirdSetup, FirdRun},
+    {"dsps_dotprod_f32", 16, N, DotprodSetup, DotprodRun},
+    {"dsps_mul_f32", 0, N, MulSetup, MulRun},
+    {"dsps_wind_hann_f32", 1024, 1024, HannSetup, HannRun},
+    {"dsps_fft2r_fc32", 1024, 1024, Fft2rSetup, Fft2rRun},
+    {"dsps_dct_f32", 64, N, DctSetup, DctRun},
+    {"qrs_detector", 0, N, QrsSetup, QrsRun},
+    {"decimator", OVERSAMPLING, N * OVERSAMPLING, DecimatorSetup, DecimatorRun},
+    {"resampler", 3, N, ResamplerSetup, ResamplerRun},
+    {"nlms_filter", 4, N, NlmsSetup, NlmsRun},
+    {"running_median", 31, N, MedianSetup, MedianRun},
+    {"ecg_codec", ECG_CODEC_LOSSLESS, N, CodecSetup, CodecRun},
+    {"ecg_codec", ECG_CODEC_DCT, N, CodecSetup, CodecRun},
+    {"spo2_algorithm", BUFFER_SIZE, BUFFER_SIZE, Spo2Setup, Spo2Run},
+    {"check_for_beat", 0, N, BeatSetup, BeatRun},
+};
+#define N_BENCHS    (sizeof(benchs) / sizeof(benchs[0]))
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * Output signature: mean, RMS, middle and last samples
+ */
+static void Signature(float *signature)
+{
+    double sum = 0, sum2 = 0;
+    for (uint32_t i = 0; i < n_out; i++) {
+        sum += out[i];
+        sum2 += (double)out[i] * out[i];
+    }
+    signature[0] = n_out ? sum / n_out : 0;
+    signature[1] = n_out ? sqrt(sum2 / n_out) : 0;
+    signature[2] = n_out ? out[n_out / 2] : 0;
+    signature[3] = n_out ? out[n_out - 1] : 0;
+}
+
+static const bench_golden_t *Golden(const bench_t *bench)
+{
+    for (unsigned i = 0; i < sizeof(golden) / sizeof(golden[0]); i++) {
+        if (strcmp(golden[i].name, bench->name) == 0 && golden[i].param == bench->param) {
+            return &golden[i];
+        }
+    }
+    return NULL;
+}
+
+static const char *CheckGolden(const bench_t *bench, const float *signature)
+{
+    const bench_golden_t *g = Golden(bench);
+    if (g == NULL) {
+        return "missing";
+    }
+    float tol = GOLDEN_TOL * fmaxf(fabsf(g->signature[1]), 1);
+    for (int k = 0; k < 4; k++) {
+        if (fabsf(signature[k] - g->signature[k]) > tol) {
+            return "mismatch";
+        }
+    }
+    return "ok";
+}
+
+int main(int argc, char **argv)
+{
+    int golden_mode = (argc > 1 && strcmp(argv[1], "--golden") == 0);
+    int failures = 0;
+    float signature[4];
+
+    SignalsInit();
+    FFTInit();
+    if (golden_mode) {
+        printf("/* Generated by obj/bench_signal_processing --golden: {name, param, {mean, rms, out[n/2], out[n-1]}} */\n");
+        printf("static const bench_golden_t golden[] = {\n");
+    } else {
+        printf("{\n  \"benchmark\": \"signal_processing\",\n  \"results\": [\n");
+    }
+    for (unsigned b = 0; b < N_BENCHS; b++) {
+        const bench_t *bench = &benchs[b];
+        /* First run: output check */
+        bench->setup(bench->param);
+        bench->run(bench->param);
+        Signature(signature);
+        if (golden_mode) {
+            printf("    {\"%s\", %d, {%.9g, %.9g, %.9g, %.9g}},\n", bench->name, bench->param,
+                   signature[0], signature[1], signature[2], signature[3]);
+            continue;
+        }
+        const char *check = CheckGolden(bench, signature);
+        if (strcmp(check, "ok") != 0) {
+            failures++;
+        }
+        /* Timed runs: best time */
+        double best = 1e9, total = 0;
+        for (int runs = 0; runs < MIN_RUNS || total < MIN_TIME; runs++) {
+            bench->setup(bench->param);
+            double t0 = Now();
+            bench->run(bench->param);
+            double t = Now() - t0;
+            total += t;
+            if (t < best) {
+                best = t;
+            }
+        }
+        printf("    {\"name\": \"%s\", \"param\": %d, \"samples\": %u, \"ns_per_sample\": %.3f, "
+               "\"msamples_per_s\": %.3f, \"golden\": \"%s\"}%s\n",
+               bench->name, bench->param, bench->samples, best * 1e9 / bench->samples,
+               bench->samples / best * 1e-6, check, (b + 1 < N_BENCHS) ? "," : "");
+    }
+    if (golden_mode) {
+        printf("};\n");
+        return EXIT_SUCCESS;
+    }
+    printf("  ],\n  \"failures\": %d\n}\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
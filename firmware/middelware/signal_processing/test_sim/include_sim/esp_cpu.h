@@ -0,0 +1,15 @@
+#ifndef _esp_cpu_h_
+#define _esp_cpu_h_
+
+#include <stdint.h>
+#include <time.h>
+
+/* Host: nanoseconds instead of CPU cycles */
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+
+#endif // _esp_cpu_h_
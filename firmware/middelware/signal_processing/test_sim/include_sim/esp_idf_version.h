@@ -0,0 +1,7 @@
+#ifndef _esp_idf_version_h_
+#define _esp_idf_version_h_
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) ((major << 16) | (minor << 8) | (patch))
+#define ESP_IDF_VERSION     ESP_IDF_VERSION_VAL(5, 5, 0)
+
+#endif // _esp_idf_version_h_
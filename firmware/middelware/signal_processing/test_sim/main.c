@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "test_sim.h"
+
+int test_failures = 0;
+
+static const struct {
+    const char *name;
+    void (*run)(void);
+} tests[] = {
+    {"qrs_detector", test_qrs_detector},
+    {"hrv", test_hrv},
+    {"goertzel", test_goertzel},
+    {"welch", test_welch},
+    {"nlms_filter", test_nlms_filter},
+    {"running_median", test_running_median},
+    {"ecg_codec", test_ecg_codec},
+    {"resampler", test_resampler},
+    {"adpcm", test_adpcm},
+    {"band_analyzer", test_band_analyzer},
+};
+
+int main(void)
+{
+    printf("main starts!\n");
+    for (int i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        int failures = test_failures;
+        tests[i].run();
+        printf("%s: %s\n", tests[i].name, (test_failures > failures) ? "FAILED" : "OK");
+    }
+    printf("Test done: %s\n", test_failures ? "FAILED" : "OK");
+    return test_failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
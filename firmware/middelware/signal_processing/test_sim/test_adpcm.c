@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "adpcm.h"
+#include "test_sim.h"
+
+#define FS          8000
+#define N_SONG      7999        /* Odd: the last byte has a single sample */
+#define CHUNK       37
+#define GOLDEN_LEN  64
+#define SETTLE      100         /* Samples for the step to adapt from its initial value */
+
+/* wav_to_edu.py adpcm_encode() output for GoldenInput() */
+static const uint8_t golden[GOLDEN_LEN / 2] = {
+    0x70, 0x77, 0x77, 0x77, 0x11, 0x01, 0x12, 0x11, 0x22, 0x32, 0x33, 0x43, 0xFF, 0xFF, 0x17, 0x80,
+    0x9F, 0x80, 0x06, 0x08, 0x0F, 0x08, 0x86, 0x80, 0x0E, 0x08, 0x86, 0x80, 0x0E, 0x08, 0x86, 0x80,
+};
+
+static const int16_t steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+static const int8_t index_change[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+/**
+ * Ramp followed by full swings: small and large codes
+ */
+static int16_t GoldenInput(int i)
+{
+    return (i < 24) ? i * 400 : ((i & 4) ? 20000 : -20000);
+}
+
+/**
+ * Same encoder as wav_to_edu.py (adpcm_encode), pred gets the predictor the decoder must follow
+ */
+static void Encode(const int16_t *x, int n, uint8_t *data, int16_t *pred)
+{
+    int32_t p = 0, index = 0;
+
+    memset(data, 0, (n + 1) / 2);
+    for (int i = 0; i < n; i++) {
+        int32_t step = steps[index];
+        int32_t diff = x[i] - p;
+        int32_t dq = step >> 3;
+        uint8_t code = 0;
+        if (diff < 0) {
+            code = 8;
+            diff = -diff;
+        }
+        if (diff >= step) {
+            code |= 4;
+            diff -= step;
+            dq += step;
+        }
+        if (diff >= step >> 1) {
+            code |= 2;
+            diff -= step >> 1;
+            dq += step >> 1;
+        }
+        if (diff >= step >> 2) {
+            code |= 1;
+            dq += step >> 2;
+        }
+        p = (code & 8) ? p - dq : p + dq;
+        p = (p < INT16_MIN) ? INT16_MIN : ((p > INT16_MAX) ? INT16_MAX : p);
+        index += index_change[code & 7];
+        index = (index < 0) ? 0 : ((index > 88) ? 88 : index);
+        data[i / 2] |= (i & 1) ? (code << 4) : code;
+        pred[i] = p;
+    }
+}
+
+/**
+ * The encoder mirrored here still matches wav_to_edu.py, and the decoder follows its predictor
+ */
+static void TestGolden(void)
+{
+    int16_t x[GOLDEN_LEN], pred[GOLDEN_LEN], out[GOLDEN_LEN];
+    uint8_t data[GOLDEN_LEN / 2];
+    adpcm_t stream;
+
+    for (int i = 0; i < GOLDEN_LEN; i++) {
+        x[i] = GoldenInput(i);
+    }
+    Encode(x, GOLDEN_LEN, data, pred);
+    CHECK(memcmp(data, golden, sizeof(golden)) == 0, "adpcm golden: encoder differs from wav_to_edu.py");
+    AdpcmInit(&stream, golden, GOLDEN_LEN);
+    uint16_t n = AdpcmDecode(&stream, out, GOLDEN_LEN);
+    CHECK(n == GOLDEN_LEN, "adpcm golden: %u samples (expected %d)", n, GOLDEN_LEN);
+    CHECK(memcmp(out, pred, sizeof(out)) == 0, "adpcm golden: decoder doesn't follow the encoder predictor");
+}
+
+/**
+ * Two tones encoded and decoded in odd sized chunks: bounded error, same output after rewinding
+ */
+static void TestRoundTrip(void)
+{
+    static int16_t x[N_SONG], pred[N_SONG], out[N_SONG], again[N_SONG];
+    static uint8_t data[(N_SONG + 1) / 2];
+    adpcm_t stream;
+    uint32_t n = 0;
+    uint16_t got;
+    double signal = 0, noise = 0;
+    int max_err = 0;
+
+    for (int i = 0; i < N_SONG; i++) {
+        x[i] = 9000 * sinf(2 * M_PI * 300 * i / FS) + 3000 * sinf(2 * M_PI * 1000 * i / FS);
+    }
+    Encode(x, N_SONG, data, pred);
+    AdpcmInit(&stream, data, N_SONG);
+    do {
+        got = AdpcmDecode(&stream, &out[n], CHUNK);
+        n += got;
+    } while (got == CHUNK);
+    CHECK(n == N_SONG, "adpcm round trip: %u samples (expected %d)", (unsigned)n, N_SONG);
+    CHECK(AdpcmDecode(&stream, again, CHUNK) == 0, "adpcm round trip: samples after the end");
+    CHECK(memcmp(out, pred, sizeof(out)) == 0, "adpcm round trip: decoder doesn't follow the encoder predictor");
+    for (int i = SETTLE; i < N_SONG; i++) {
+        int err = abs(out[i] - x[i]);
+        max_err = (err > max_err) ? err : max_err;
+        signal += (double)x[i] * x[i];
+        noise += (double)err * err;
+    }
+    float snr = 10 * log10(signal / noise);
+    CHECK(snr > 25, "adpcm round trip: SNR %.1f dB", snr);
+    CHECK(max_err < 1000, "adpcm round trip: max error %d", max_err);
+
+    AdpcmInit(&stream, data, N_SONG);
+    CHECK(AdpcmDecode(&stream, again, N_SONG) == N_SONG && memcmp(out, again, sizeof(out)) == 0,
+          "adpcm round trip: different output after AdpcmInit()");
+    printf("adpcm round trip: %d samples in %d bytes, SNR %.1f dB, max error %d\n", N_SONG, (int)sizeof(data), snr, max_err);
+}
+
+/**
+ * Largest codes take the step index to 88 and the predictor to the int16 limits, zero codes
+ * take the index back to 0
+ */
+static void TestClamp(void)
+{
+    static uint8_t data[3 * 64];
+    int16_t out;
+    adpcm_t stream;
+    int index_min = 88, index_max = 0;
+
+    memset(&data[0], 0x77, 64);             /* +7: index +8 */
+    memset(&data[64], 0xFF, 64);            /* -7: index +8 */
+    memset(&data[128], 0x00, 64);           /* +0: index -1 */
+    AdpcmInit(&stream, data, 2 * sizeof(data));
+    for (int i = 0; i < 2 * sizeof(data); i++) {
+        AdpcmDecode(&stream, &out, 1);
+        index_min = (stream.index < index_min) ? stream.index : index_min;
+        index_max = (stream.index > index_max) ? stream.index : index_max;
+        if (i == 127) {
+            CHECK(stream.index == 88 && out == INT16_MAX, "adpcm clamp: index %u, predictor %d after +7 codes", stream.index, out);
+        } else if (i == 255) {
+            CHECK(stream.index == 88 && out == INT16_MIN, "adpcm clamp: index %u, predictor %d after -7 codes", stream.index, out);
+        }
+    }
+    CHECK(index_max == 88, "adpcm clamp: max index %d", index_max);
+    CHECK(index_min == 0 && stream.index == 0, "adpcm clamp: index %u after 0 codes", stream.index);
+}
+
+void test_adpcm(void)
+{
+    TestGolden();
+    TestRoundTrip();
+    TestClamp();
+}
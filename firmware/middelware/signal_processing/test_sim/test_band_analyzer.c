@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "fft.h"
+#include "band_analyzer.h"
+#include "test_sim.h"
+
+#define FS          8000
+#define N           1024
+#define BANDS       16
+#define F_MIN       60.0f
+#define F_MAX       4000.0f
+
+/**
+ * Band of each scale that contains f (same spacing as BandAnalyzerInit())
+ */
+static int ExpectedBand(band_scale_t scale, float f)
+{
+    float frac;
+    if (scale == BAND_SCALE_MEL) {
+        float m_min = 2595.0f * log10f(1 + F_MIN / 700);
+        float m_max = 2595.0f * log10f(1 + F_MAX / 700);
+        frac = (2595.0f * log10f(1 + f / 700) - m_min) / (m_max - m_min);
+    } else {
+        frac = logf(f / F_MIN) / logf(F_MAX / F_MIN);
+    }
+    return (int)(frac * BANDS);
+}
+
+/**
+ * Pure tones (FFTPower spectrum) light the band that contains them, the other bands stay empty
+ */
+static void TestTone(band_scale_t scale, const char *name)
+{
+    static const float tones[] = {100, 250, 440, 1000, 2200, 3500};
+    static float signal[N], power[N / 2];
+    band_analyzer_t analyzer = {
+        .n_bands = BANDS, .scale = scale, .sample_freq = FS, .signal_lenght = N,
+        .f_min = F_MIN, .f_max = F_MAX, .floor_db = -60, .range_db = 80,
+        .attack = 1, .decay = 100, .peak_hold = 0, .peak_decay = 100
+    };
+    uint8_t bars[BANDS];
+
+    for (int t = 0; t < sizeof(tones) / sizeof(tones[0]); t++) {
+        for (int i = 0; i < N; i++) {
+            signal[i] = sinf(2 * M_PI * tones[t] * i / FS) * (0.5f - 0.5f * cosf(2 * M_PI * i / N));
+        }
+        FFTPower(signal, power, N);
+        BandAnalyzerInit(&analyzer);
+        BandAnalyzerUpdate(&analyzer, power, bars, NULL);
+        int best = 0;
+        for (int i = 1; i < BANDS; i++) {
+            best = (bars[i] > bars[best]) ? i : best;
+        }
+        int expected = ExpectedBand(scale, tones[t]);
+        CHECK(best == expected, "band analyzer %s: %.0f Hz in band %d (expected %d)", name, tones[t], best, expected);
+        for (int i = 0; i < BANDS; i++) {
+            if (abs(i - expected) > 1) {
+                CHECK(bars[i] < bars[expected] / 4, "band analyzer %s: %.0f Hz, band %d bar %u (tone band %u)",
+                      name, tones[t], i, bars[i], bars[expected]);
+            }
+        }
+    }
+}
+
+/**
+ * A flat spectrum gives the same mean power in every band, whatever its width in bins
+ */
+static void TestFlat(void)
+{
+    static float power[N / 2];
+    band_analyzer_t analyzer = {
+        .n_bands = BANDS, .scale = BAND_SCALE_LOG, .sample_freq = FS, .signal_lenght = N,
+        .f_min = F_MIN, .f_max = F_MAX, .floor_db = 0, .range_db = 60, .attack = 1, .decay = 100
+    };
+    uint8_t bars[BANDS];
+    float err = 0;
+
+    for (int i = 0; i < N / 2; i++) {
+        power[i] = 1000;
+    }
+    BandAnalyzerInit(&analyzer);
+    BandAnalyzerUpdate(&analyzer, power, bars, NULL);
+    for (int i = 0; i < BANDS; i++) {
+        err = fmaxf(err, fabsf(analyzer.level[i] - 30));
+    }
+    CHECK(err < 0.01f, "band analyzer flat: level error %f dB", err);
+    CHECK(bars[0] == 127 && bars[BANDS - 1] == 127, "band analyzer flat: bars %u, %u (expected 127)", bars[0], bars[BANDS - 1]);
+}
+
+/**
+ * Level rises with the attack coefficient and falls decay dB per frame, the peak is held and then falls
+ */
+static void TestSmoothing(void)
+{
+    static float power[N / 2];
+    band_analyzer_t analyzer = {
+        .n_bands = 1, .scale = BAND_SCALE_LOG, .sample_freq = FS, .signal_lenght = N,
+        .f_min = F_MIN, .f_max = F_MAX, .floor_db = 0, .range_db = 60,
+        .attack = 0.5f, .decay = 3, .peak_hold = 4, .peak_decay = 2
+    };
+    uint8_t bars[1], peaks[1];
+    int frame;
+
+    BandAnalyzerInit(&analyzer);
+    /* 0 dB to 60 dB: the distance to 60 dB halves every frame */
+    for (int i = 0; i < N / 2; i++) {
+        power[i] = 1e6f;
+    }
+    for (frame = 1; frame <= 12; frame++) {
+        float previous = analyzer.level[0];
+        BandAnalyzerUpdate(&analyzer, power, bars, peaks);
+        float expected = 60 - 60 * powf(0.5f, frame);
+        CHECK(fabsf(analyzer.level[0] - expected) < 0.01f && analyzer.level[0] > previous,
+              "band analyzer attack: frame %d, level %.3f dB (expected %.3f)", frame, analyzer.level[0], expected);
+    }
+    CHECK(fabsf(analyzer.level[0] - 60) < 0.05f && bars[0] >= 254, "band analyzer attack: level %.3f dB, bar %u after 12 frames",
+          analyzer.level[0], bars[0]);
+    float top = analyzer.peak[0];
+
+    /* 60 dB to 30 dB: 3 dB per frame, peak held 4 frames and then 2 dB per frame */
+    for (int i = 0; i < N / 2; i++) {
+        power[i] = 1e3f;
+    }
+    for (frame = 1; frame <= 12; frame++) {
+        BandAnalyzerUpdate(&analyzer, power, bars, peaks);
+        float expected = fmaxf(30, 60 - 3 * frame);
+        float expected_peak = (frame <= 4) ? top : fmaxf(top - 2 * (frame - 4), analyzer.level[0]);
+        CHECK(fabsf(analyzer.level[0] - expected) < 0.05f,
+              "band analyzer decay: frame %d, level %.3f dB (expected %.3f)", frame, analyzer.level[0], expected);
+        CHECK(fabsf(analyzer.peak[0] - expected_peak) < 0.05f,
+              "band analyzer peak: frame %d, peak %.3f dB (expected %.3f)", frame, analyzer.peak[0], expected_peak);
+    }
+    CHECK(bars[0] == 127, "band analyzer decay: bar %u after 12 frames (expected 127)", bars[0]);
+    printf("band analyzer: level %.2f dB, peak %.2f dB after the decay\n", analyzer.level[0], analyzer.peak[0]);
+}
+
+void test_band_analyzer(void)
+{
+    FFTInit();
+    TestTone(BAND_SCALE_LOG, "log");
+    TestTone(BAND_SCALE_MEL, "mel");
+    TestFlat();
+    TestSmoothing();
+}
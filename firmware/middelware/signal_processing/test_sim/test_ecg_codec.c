@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ecg_codec.h"
+#include "fft.h"
+#include "ecg_data.h"
+#include "test_sim.h"
+
+#define FS          250
+#define SIGNAL_LEN  (60 * FS)
+#define CHUNK       16      /* Samples given to the encoder each time */
+#define BLOCK       64
+
+/**
+ * ECG as sent by ej_bluetooth_filter (bundled beat), with baseline wander and noise (LSB)
+ */
+static void BuildSignal(int16_t *signal, int noise)
+{
+    for (int n = 0; n < SIGNAL_LEN; n++) {
+        float t = (float)n / FS;
+        signal[n] = ecg[n % ECG_LENGHT] + 10 * sinf(2 * M_PI * 0.3f * t) + (noise ? rand() % (2 * noise + 1) - noise : 0);
+    }
+}
+
+/**
+ * Encodes the signal in CHUNK samples blocks, returns the bytes of all the packets
+ */
+static int Encode(ecg_codec_t *codec, const int16_t *signal, int n, uint8_t *data)
+{
+    int bytes = 0;
+    EcgCodecInit(codec);
+    for (int i = 0; i < n; i += CHUNK) {
+        bytes += EcgCodecEncode(codec, &signal[i], (i + CHUNK <= n) ? CHUNK : n - i, &data[bytes]);
+    }
+    bytes += EcgCodecFlush(codec, &data[bytes]);
+    return bytes;
+}
+
+/**
+ * Decodes all the packets, returns the samples decoded (-1 if a packet is not valid)
+ */
+static int Decode(const uint8_t *data, int bytes, int16_t *signal)
+{
+    int n = 0, pos = 0;
+    uint16_t len, packet;
+    while (pos < bytes) {
+        packet = EcgCodecDecode(&data[pos], (bytes - pos > 65535) ? 65535 : bytes - pos, &signal[n], &len);
+        if (packet == 0) {
+            return -1;
+        }
+        pos += packet;
+        n += len;
+    }
+    return n;
+}
+
+/**
+ * Bytes of the same samples sent as ej_bluetooth_filter does ("*G%.2f*" each)
+ */
+static int AsciiBytes(const int16_t *signal, int n)
+{
+    char msg[32];
+    int bytes = 0;
+    for (int i = 0; i < n; i++) {
+        bytes += sprintf(msg, "*G%.2f*", (float)signal[i]);
+    }
+    return bytes;
+}
+
+static void TestLossless(const int16_t *signal, float min_ratio)
+{
+    static uint8_t data[ECG_CODEC_OUT_MAX(SIGNAL_LEN)];
+    static int16_t decoded[SIGNAL_LEN + ECG_CODEC_BLOCK_MAX];
+    ecg_codec_t codec = {.mode = ECG_CODEC_LOSSLESS, .block_lenght = BLOCK};
+
+    int bytes = Encode(&codec, signal, SIGNAL_LEN, data);
+    int n = Decode(data, bytes, decoded);
+    CHECK(n == SIGNAL_LEN && memcmp(signal, decoded, sizeof(int16_t) * SIGNAL_LEN) == 0, "ecg codec lossless: decoded samples differ");
+    printf("ecg codec lossless: %.2f bits/sample, %.1fx less than int16, %.1fx less than ASCII\n",
+           8.0f * bytes / SIGNAL_LEN, 2.0f * SIGNAL_LEN / bytes, (float)AsciiBytes(signal, SIGNAL_LEN) / bytes);
+    CHECK(2.0f * SIGNAL_LEN / bytes > min_ratio, "ecg codec lossless: compression");
+
+    /* Extreme values (raw coded prediction errors) and a block not completed (flush) */
+    static const int16_t extreme[] = {INT16_MAX, INT16_MIN, INT16_MAX, 0, -1, INT16_MIN, 5, 7, 7, 7};
+    int16_t out[ECG_CODEC_BLOCK_MAX];
+    bytes = Encode(&codec, extreme, sizeof(extreme) / sizeof(extreme[0]), data);
+    n = Decode(data, bytes, out);
+    CHECK(n == sizeof(extreme) / sizeof(extreme[0]) && memcmp(extreme, out, sizeof(extreme)) == 0, "ecg codec lossless: extreme values");
+    /* Incomplete packet */
+    uint16_t len;
+    CHECK(EcgCodecDecode(data, bytes - 1, out, &len) == 0, "ecg codec: incomplete packet accepted");
+}
+
+static void TestDct(const int16_t *signal, float prd)
+{
+    static uint8_t data[ECG_CODEC_OUT_MAX(SIGNAL_LEN)];
+    static int16_t decoded[SIGNAL_LEN + ECG_CODEC_BLOCK_MAX];
+    ecg_codec_t codec = {.mode = ECG_CODEC_DCT, .block_lenght = BLOCK, .prd = prd};
+
+    int bytes = Encode(&codec, signal, SIGNAL_LEN, data);
+    int n = Decode(data, bytes, decoded);
+    CHECK(n == SIGNAL_LEN, "ecg codec dct: %d samples decoded", n);
+    /* PRD of each block and of the whole signal */
+    float worst = 0, max_error = 0;
+    double total_err = 0, total_energy = 0;
+    for (int b = 0; b + BLOCK <= n; b += BLOCK) {
+        double mean = 0, err = 0, energy = 0;
+        for (int i = b; i < b + BLOCK; i++) {
+            mean += signal[i];
+        }
+        mean /= BLOCK;
+        for (int i = b; i < b + BLOCK; i++) {
+            err += (double)(decoded[i] - signal[i]) * (decoded[i] - signal[i]);
+            energy += (signal[i] - mean) * (signal[i] - mean);
+            max_error = fmaxf(max_error, abs(decoded[i] - signal[i]));
+        }
+        worst = fmaxf(worst, 100 * sqrt(err / energy));
+        total_err += err;
+        total_energy += energy;
+    }
+    printf("ecg codec dct (PRD %.1f %%): %.2f bits/sample, %.1fx less than int16, %.1fx less than ASCII, PRD %.2f %% (worst block %.2f %%), max error %.0f\n",
+           prd, 8.0f * bytes / SIGNAL_LEN, 2.0f * SIGNAL_LEN / bytes, (float)AsciiBytes(signal, SIGNAL_LEN) / bytes,
+           100 * sqrt(total_err / total_energy), worst, max_error);
+    CHECK(worst <= prd * 1.001f, "ecg codec dct: block PRD %.2f %% over %.1f %%", worst, prd);
+}
+
+void test_ecg_codec(void)
+{
+    static int16_t signal[SIGNAL_LEN];
+    FFTInit();
+    BuildSignal(signal, 0);
+    TestLossless(signal, 2.5f);
+    TestDct(signal, 1);
+    TestDct(signal, 3);
+    /* Scaled as a 12 bits ADC (x 8), with noise */
+    for (int n = 0; n < SIGNAL_LEN; n++) {
+        signal[n] = 2048 + 8 * (signal[n] - 100) + (rand() % 9 - 4);
+    }
+    TestLossless(signal, 1.5f);
+    TestDct(signal, 1);
+    TestDct(signal, 3);
+}
@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "fft.h"
+#include "test_sim.h"
+
+#define FS          8000
+#define BLOCK       205     /* DTMF usual block: 39 Hz resolution at 8 kHz */
+
+/**
+ * Phase difference wrapped to [-pi, pi]
+ */
+static float PhaseError(float a, float b)
+{
+    float d = fmodf(a - b, 2 * M_PI);
+    if (d > M_PI) {
+        d -= 2 * M_PI;
+    } else if (d < -M_PI) {
+        d += 2 * M_PI;
+    }
+    return fabsf(d);
+}
+
+/**
+ * Goertzel results against a direct DFT of the same block, at frequencies off the bin grid,
+ * with the signal fed in odd sized chunks
+ */
+static void TestDft(void)
+{
+    static float signal[3 * BLOCK];
+    goertzel_t bank = {.sample_freq = FS, .block_lenght = BLOCK, .n_bins = 4, .freq = {0, 697, 1209.5f, 3000}};
+    float mag[GOERTZEL_BINS_MAX], phase[GOERTZEL_BINS_MAX];
+    int blocks = 0;
+
+    for (int i = 0; i < 3 * BLOCK; i++) {
+        signal[i] = 0.3f + sinf(2 * M_PI * 697 * i / FS + 0.4f) + 0.5f * cosf(2 * M_PI * 1209.5f * i / FS) + 0.1f * (rand() / (float)RAND_MAX - 0.5f);
+    }
+    GoertzelInit(&bank);
+    for (int i = 0; i < 3 * BLOCK; i += 37) {
+        int len = (i + 37 <= 3 * BLOCK) ? 37 : 3 * BLOCK - i;
+        if (!GoertzelProcess(&bank, &signal[i], len, mag, phase)) {
+            continue;
+        }
+        int start = blocks * BLOCK;
+        blocks++;
+        for (int k = 0; k < bank.n_bins; k++) {
+            double re = 0, im = 0;
+            double w = 2 * M_PI * bank.freq[k] / FS;
+            for (int n = 0; n < BLOCK; n++) {
+                re += signal[start + n] * cos(w * n);
+                im -= signal[start + n] * sin(w * n);
+            }
+            float expected = sqrt(re * re + im * im) * ((k == 0) ? 1.0 : 2.0) / BLOCK;
+            CHECK(fabsf(mag[k] - expected) < 1e-3f * (1 + expected), "goertzel %.1f Hz: magnitude %f (expected %f)", bank.freq[k], mag[k], expected);
+            if (expected > 0.1f) {
+                CHECK(PhaseError(phase[k], atan2(im, re)) < 1e-3f, "goertzel %.1f Hz: phase %f (expected %f)", bank.freq[k], phase[k], atan2(im, re));
+            }
+        }
+    }
+    CHECK(blocks == 3, "goertzel: %d blocks (expected 3)", blocks);
+    printf("goertzel DFT: %d blocks, DC %.3f, 697 Hz %.3f (phase %.3f), 1209.5 Hz %.3f, 3000 Hz %.3f\n",
+           blocks, mag[0], mag[1], phase[1], mag[2], mag[3]);
+}
+
+/**
+ * DTMF key detection: the two highest bins of the row and column groups
+ */
+static void TestDtmf(void)
+{
+    static const float rows[] = {697, 770, 852, 941};
+    static const float cols[] = {1209, 1336, 1477, 1633};
+    static const char keys[] = "123A456B789C*0#D";
+    static float signal[BLOCK];
+    goertzel_t bank = {.sample_freq = FS, .block_lenght = BLOCK, .n_bins = 8};
+    float mag[GOERTZEL_BINS_MAX];
+
+    for (int k = 0; k < 4; k++) {
+        bank.freq[k] = rows[k];
+        bank.freq[k + 4] = cols[k];
+    }
+    GoertzelInit(&bank);
+    int right = 0;
+    for (int key = 0; key < 16; key++) {
+        int r = key / 4, c = key % 4;
+        for (int i = 0; i < BLOCK; i++) {
+            signal[i] = 0.5f * sinf(2 * M_PI * rows[r] * i / FS) + 0.5f * sinf(2 * M_PI * cols[c] * i / FS) + 0.2f * (rand() / (float)RAND_MAX - 0.5f);
+        }
+        CHECK(GoertzelProcess(&bank, signal, BLOCK, mag, NULL), "dtmf: block not ended");
+        int best_r = 0, best_c = 0;
+        for (int k = 1; k < 4; k++) {
+            best_r = (mag[k] > mag[best_r]) ? k : best_r;
+            best_c = (mag[k + 4] > mag[best_c + 4]) ? k : best_c;
+        }
+        CHECK(best_r == r && best_c == c, "dtmf: key %c detected as %c", keys[key], keys[best_r * 4 + best_c]);
+        right += (best_r == r && best_c == c);
+    }
+    printf("goertzel DTMF: %d/16 keys\n", right);
+}
+
+void test_goertzel(void)
+{
+    TestDft();
+    TestDtmf();
+}
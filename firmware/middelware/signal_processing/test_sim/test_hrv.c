@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "hrv.h"
+#include "test_sim.h"
+
+/**
+ * RR series (ms) with a LF (0.1 Hz) and a HF (0.25 Hz) modulation, sampled at each beat
+ */
+static uint16_t ModulatedRR(float t, float lf_amp, float hf_amp)
+{
+    return 800 + lf_amp * sinf(2 * M_PI * 0.1f * t) + hf_amp * sinf(2 * M_PI * 0.25f * t);
+}
+
+/**
+ * Time domain metrics calculated from scratch over the RR intervals of the window
+ */
+static void BruteForce(const uint16_t *rr, const int *valid_diff, int n, hrv_time_t *m)
+{
+    double sum = 0, ss = 0, d2 = 0;
+    int n_diff = 0, nn50 = 0;
+    for (int i = 0; i < n; i++) {
+        sum += rr[i];
+    }
+    double mean = sum / n;
+    for (int i = 0; i < n; i++) {
+        ss += (rr[i] - mean) * (rr[i] - mean);
+        if (i > 0 && valid_diff[i]) {
+            int d = rr[i] - rr[i - 1];
+            d2 += d * d;
+            n_diff++;
+            nn50 += abs(d) > 50;
+        }
+    }
+    m->mean_rr = mean;
+    m->sdnn = sqrt(ss / (n - 1));
+    m->rmssd = sqrt(d2 / n_diff);
+    m->pnn50 = 100.0 * nn50 / n_diff;
+}
+
+static void TestTimeDomain(void)
+{
+    static uint16_t all[4000];
+    static int valid[4000];
+    hrv_t hrv = {.window_ms = 60000};
+    hrv_time_t m, ref;
+    int n_all = 0, gap = 1;
+    float t = 0;
+
+    HrvInit(&hrv);
+    srand(1);
+    for (int beat = 0; beat < 2000; beat++) {
+        uint16_t rr = ModulatedRR(t, 50, 30) + rand() % 60;
+        if (beat % 97 == 50) {
+            rr = 2500;      /* artifact: discarded */
+        }
+        t += rr / 1000.0f;
+        HrvAddRR(&hrv, rr);
+        if (rr > HRV_RR_MAX) {
+            gap = 1;
+            continue;
+        }
+        valid[n_all] = !gap;
+        all[n_all++] = rr;
+        gap = 0;
+        if (beat % 100 == 99) {
+            /* Window: last beats that cover window_ms */
+            int first = n_all - 1;
+            uint32_t span = all[first];
+            while (first > 0 && span < hrv.window_ms) {
+                span += all[--first];
+            }
+            int valid_window[4000];
+            for (int i = first; i < n_all; i++) {
+                valid_window[i - first] = (i > first) && valid[i];
+            }
+            BruteForce(&all[first], valid_window, n_all - first, &ref);
+            CHECK(HrvTimeDomain(&hrv, &m), "time domain: not calculated");
+            CHECK(hrv.n == n_all - first, "time domain: %u beats in window (expected %d)", hrv.n, n_all - first);
+            CHECK(fabsf(m.mean_rr - ref.mean_rr) < 0.01f, "mean RR %.3f (expected %.3f)", m.mean_rr, ref.mean_rr);
+            CHECK(fabsf(m.sdnn - ref.sdnn) < 0.01f, "SDNN %.3f (expected %.3f)", m.sdnn, ref.sdnn);
+            CHECK(fabsf(m.rmssd - ref.rmssd) < 0.01f, "RMSSD %.3f (expected %.3f)", m.rmssd, ref.rmssd);
+            CHECK(fabsf(m.pnn50 - ref.pnn50) < 0.01f, "pNN50 %.3f (expected %.3f)", m.pnn50, ref.pnn50);
+        }
+    }
+    printf("hrv time domain: mean RR %.1f ms, SDNN %.1f ms, RMSSD %.1f ms, pNN50 %.1f %%\n",
+           m.mean_rr, m.sdnn, m.rmssd, m.pnn50);
+}
+
+static void TestFreqDomain(float lf_amp, float hf_amp)
+{
+    hrv_t hrv = {.window_ms = 300000};
+    hrv_freq_t m;
+    float t = 0;
+
+    HrvInit(&hrv);
+    while (t < 400) {
+        uint16_t rr = ModulatedRR(t, lf_amp, hf_amp);
+        t += rr / 1000.0f;
+        HrvAddRR(&hrv, rr);
+    }
+    /* A sine of amplitude A has a power of A^2 / 2 */
+    float lf = lf_amp * lf_amp / 2, hf = hf_amp * hf_amp / 2;
+    CHECK(HrvFreqDomain(&hrv, &m), "frequency domain: not calculated");
+    printf("hrv frequency domain: LF %.0f ms^2 (expected %.0f), HF %.0f ms^2 (expected %.0f), LF/HF %.2f\n",
+           m.lf, lf, m.hf, hf, m.lf_hf);
+    CHECK(fabsf(m.lf - lf) < 0.15f * lf + 20, "LF power");
+    CHECK(fabsf(m.hf - hf) < 0.15f * hf + 20, "HF power");
+}
+
+static void TestWindowLimits(void)
+{
+    hrv_t hrv = {.window_ms = 0};
+    uint32_t span = 0;
+
+    HrvInit(&hrv);
+    CHECK(hrv.window_ms == HRV_WINDOW_MIN, "window of 0 ms not clamped (%u ms)", (unsigned)hrv.window_ms);
+    HrvAddRR(&hrv, 800);
+    CHECK(hrv.n == 1, "window of 0 ms: %u beats", hrv.n);
+
+    /* 5 min at the highest heart rate: no beat may be lost */
+    hrv.window_ms = 10 * HRV_WINDOW_MAX;
+    HrvInit(&hrv);
+    CHECK(hrv.window_ms == HRV_WINDOW_MAX, "window of %u ms not clamped", 10 * HRV_WINDOW_MAX);
+    while (span < HRV_WINDOW_MAX - HRV_RR_MIN) {
+        HrvAddRR(&hrv, HRV_RR_MIN);
+        span += HRV_RR_MIN;
+    }
+    CHECK(hrv.n == span / HRV_RR_MIN, "5 min window at %d ms: %u beats (expected %u)", HRV_RR_MIN, hrv.n, (unsigned)(span / HRV_RR_MIN));
+}
+
+void test_hrv(void)
+{
+    TestWindowLimits();
+    TestTimeDomain();
+    TestFreqDomain(50, 30);
+    TestFreqDomain(20, 40);
+}
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "nlms_filter.h"
+#include "test_sim.h"
+
+#define FS          100
+#define TEST_TIME   90      /* s */
+#define SETTLE      30      /* s: adaptation time, not evaluated */
+#define N           (TEST_TIME * FS)
+
+/**
+ * Pulse waveform (1.2 Hz, 72 bpm) with its harmonics
+ */
+static float Pulse(int n, float amp)
+{
+    float t = (float)n / FS;
+    return amp * (sinf(2 * M_PI * 1.2f * t) + 0.4f * sinf(2 * M_PI * 2.4f * t + 1) + 0.15f * sinf(2 * M_PI * 3.6f * t + 2));
+}
+
+void test_nlms_filter(void)
+{
+    static float acc[N * 3], ppg[N * 2], clean[N * 2];
+    static nlms_filter_t nlms = {.sample_freq = FS, .n_refs = 3, .n_channels = 2, .taps = 4, .mu = 0.01f};
+    float a[3] = {0, 0, 0};
+
+    /* Accelerometer: gravity plus random arm movements (band limited noise) and walking (1.8 Hz) */
+    for (int n = 0; n < N; n++) {
+        float t = (float)n / FS;
+        for (int r = 0; r < 3; r++) {
+            a[r] = 0.9f * a[r] + 300 * (rand() / (float)RAND_MAX - 0.5f);
+            acc[n * 3 + r] = (r == 2 ? 16384 : 0) + a[r] + 800 * sinf(2 * M_PI * 1.8f * t + r);
+        }
+    }
+    /* PPG: DC + pulse + motion artifact (delayed and filtered accelerometer), red and IR */
+    for (int n = 3; n < N; n++) {
+        float m = 0.5f * (acc[(n - 1) * 3] + acc[(n - 2) * 3]) - 0.3f * acc[(n - 3) * 3 + 1] + 0.2f * (acc[n * 3 + 2] - 16384);
+        ppg[n * 2] = 50000 + Pulse(n, 200) + 0.6f * m;
+        ppg[n * 2 + 1] = 80000 + Pulse(n, 300) + 0.9f * m;
+    }
+    NlmsFilterInit(&nlms);
+    /* 100 Hz loop, 25 samples blocks as ej_max3010x */
+    for (int n = 0; n < N; n += 25) {
+        NlmsFilterProcess(&nlms, &acc[n * 3], &ppg[n * 2], &clean[n * 2], 25);
+    }
+    /* Artifact power left, against the artifact power, after adaptation. The canceller works
+     * above 0.5 Hz (slower movements are left as baseline wander): the artifact is high passed
+     * as in the canceller, and the part below 0.5 Hz is taken from the error. */
+    float pole = 1 - 2 * M_PI * 0.5f / FS;
+    for (int c = 0; c < 2; c++) {
+        double before = 0, after = 0, mean_a = 0;
+        float dc = c ? 80000 : 50000, amp = c ? 300 : 200;
+        float b_prev = 0, b_ac = 0;
+        int count = 0;
+        for (int n = 0; n < N; n++) {
+            float b = ppg[n * 2 + c] - dc - Pulse(n, amp);
+            float e = clean[n * 2 + c] - dc - Pulse(n, amp);
+            b_ac = b - b_prev + pole * b_ac;
+            b_prev = b;
+            if (n >= SETTLE * FS) {
+                float r = e - (b - b_ac);
+                before += b_ac * b_ac;
+                after += r * r;
+                mean_a += e;
+                count++;
+            }
+        }
+        mean_a /= count;
+        before /= count;
+        after /= count;
+        float reduction = 10 * log10(before / after);
+        printf("nlms %s: artifact %.1f -> %.1f rms, %.1f dB reduction, DC %.0f (expected %.0f)\n",
+               c ? "ir " : "red", sqrt(before), sqrt(after), reduction, dc + mean_a, dc);
+        CHECK(reduction > 10, "nlms channel %d: artifact reduction %.1f dB", c, reduction);
+        CHECK(fabs(mean_a) < 0.01f * dc, "nlms channel %d: DC not kept", c);
+    }
+}
@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "qrs_detector.h"
+#include "ecg_data.h"
+#include "test_sim.h"
+
+#define CHUNK           16      /* Same blocks as ej_lcdcolor_ecg */
+#define TEST_TIME       60      /* Seconds of signal of each test */
+#define LEARN_TIME      2.0f    /* Detector's learning phase (s): no beats reported */
+#define REPORT_DELAY    0.3f    /* A beat is reported once its integrated hump has fallen (s) */
+#define BEAT_TOLERANCE  0.05f   /* Beat position error allowed (s): band-pass filter delay */
+
+static int NoGap(int beat)
+{
+    (void)beat;
+    return 0;
+}
+
+static int VariableGap(int beat)
+{
+    return (beat * 37) % 90;
+}
+
+/**
+ * Builds TEST_TIME seconds of ECG repeating the bundled beat, with gap(i) baseline samples
+ * after beat i. Baseline wander, mains interference and noise are added if requested.
+ * The position of each R wave is stored in r_wave, returns the samples of the signal.
+ */
+static int BuildSignal(float *signal, float fs, int (*gap)(int), int noise, int *r_wave, int *n_r)
+{
+    int max = TEST_TIME * fs;
+    int n = 0;
+    *n_r = 0;
+    for (int beat = 0; n < max; beat++) {
+        r_wave[(*n_r)++] = n + ECG_R_WAVE;
+        for (int i = 0; i < ECG_LENGHT && n < max; i++) {
+            signal[n++] = ecg[i];
+        }
+        for (int i = 0; i < gap(beat) && n < max; i++) {
+            signal[n++] = ecg[ECG_LENGHT - 1];
+        }
+    }
+    if (noise) {
+        for (int i = 0; i < n; i++) {
+            float t = i / fs;
+            signal[i] += 8 * sinf(2 * M_PI * 50 * t) + 40 * sinf(2 * M_PI * 0.3f * t) + 4.0f * (rand() / (float)RAND_MAX - 0.5f);
+        }
+    }
+    return n;
+}
+
+/**
+ * Runs the detector over a signal in CHUNK samples blocks. Stores the time (sample) and RR
+ * interval of each beat reported, returns the number of beats. n is updated to the samples
+ * processed (whole chunks).
+ */
+static int RunDetector(qrs_detector_t *det, const float *signal, int *n, uint32_t *time, uint16_t *rr)
+{
+    int n_beats = 0;
+    int i;
+    for (i = 0; i + CHUNK <= *n; i += CHUNK) {
+        uint8_t beats = QrsDetectorProcess(det, &signal[i], CHUNK, &rr[n_beats]);
+        /* A chunk is shorter than the refractory period: one beat at most */
+        CHECK(beats <= 1, "%u beats in a chunk", beats);
+        if (beats) {
+            time[n_beats++] = det->last_beat;
+        }
+    }
+    *n = i;
+    return n_beats;
+}
+
+/**
+ * Returns the R wave closest to a beat, -1 if none is close enough
+ */
+static int MatchBeat(uint32_t time, const int *r_wave, int n_r, float fs)
+{
+    for (int i = 0; i < n_r; i++) {
+        if (fabsf((float)time - r_wave[i]) <= BEAT_TOLERANCE * fs) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void TestDetector(const char *name, float fs, int (*gap)(int), int noise)
+{
+    static float signal[TEST_TIME * 500];
+    static int r_wave[TEST_TIME * 10];
+    static uint32_t time[TEST_TIME * 10];
+    static uint16_t rr[TEST_TIME * 10];
+    int n_r;
+    int n = BuildSignal(signal, fs, gap, noise, r_wave, &n_r);
+    qrs_detector_t det = {.sample_freq = fs};
+    QrsDetectorInit(&det);
+    int n_beats = RunDetector(&det, signal, &n, time, rr);
+
+    /* Every R wave after the learning phase must be reported, except the ones too close to the end */
+    int expected = 0;
+    for (int i = 0; i < n_r; i++) {
+        if (r_wave[i] >= LEARN_TIME * fs && r_wave[i] + REPORT_DELAY * fs <= n) {
+            expected++;
+        }
+    }
+    int detected = 0, false_beats = 0, rr_right = 0, prev = -1;
+    for (int k = 0; k < n_beats; k++) {
+        int i = MatchBeat(time[k], r_wave, n_r, fs);
+        if (i < 0 || r_wave[i] < LEARN_TIME * fs) {
+            false_beats++;
+            prev = -1;
+            continue;
+        }
+        if (r_wave[i] + REPORT_DELAY * fs <= n) {
+            detected++;
+        }
+        /* RR interval: 0 for the first beat, else the distance to the previous R wave */
+        float expected_rr = (k == 0) ? 0 : (prev == i - 1) ? (r_wave[i] - r_wave[i - 1]) * 1000 / fs : -1;
+        if (fabsf(rr[k] - expected_rr) <= 1000 / fs + 1) {
+            rr_right++;
+        }
+        prev = i;
+    }
+    printf("%-12s fs=%3.0f: %3d beats (expected %3d), %d false, %3d RR intervals right, %3u bpm\n",
+           name, fs, detected, expected, false_beats, rr_right, QrsDetectorHeartRate(&det));
+    CHECK(detected == expected, "%s fs=%.0f: %d beats detected (expected %d)", name, fs, detected, expected);
+    CHECK(false_beats == 0, "%s fs=%.0f: %d false beats", name, fs, false_beats);
+    CHECK(rr_right == n_beats, "%s fs=%.0f: %d RR intervals right of %d", name, fs, rr_right, n_beats);
+    if (gap == NoGap) {
+        int bpm = 60 * fs / ECG_LENGHT;
+        CHECK(abs((int)QrsDetectorHeartRate(&det) - bpm) <= 1, "%s fs=%.0f: heart rate (expected %d)", name, fs, bpm);
+    }
+}
+
+void test_qrs_detector(void)
+{
+    TestDetector("regular", 200, NoGap, 0);
+    TestDetector("regular", 250, NoGap, 0);
+    TestDetector("noisy", 250, NoGap, 1);
+    TestDetector("noisy", 500, NoGap, 1);
+    TestDetector("variable RR", 250, VariableGap, 0);
+    TestDetector("variable RR", 250, VariableGap, 1);
+}
@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "resampler.h"
+#include "test_sim.h"
+
+#define N_IN        3000
+#define BLOCK       50
+#define SETTLE      200     /* Output samples skipped while the filter history fills */
+
+/**
+ * Amplitude of the f (fraction of the sample rate) component of x, by projection on a complex exponential
+ */
+static float Amplitude(const float *x, int n, float f)
+{
+    double re = 0, im = 0;
+    for (int i = 0; i < n; i++) {
+        re += x[i] * cos(2 * M_PI * f * i);
+        im -= x[i] * sin(2 * M_PI * f * i);
+    }
+    return 2 * sqrt(re * re + im * im) / n;
+}
+
+/**
+ * Resamples a sine of tone Hz sampled at fs in BLOCK sized chunks, returns the output length
+ */
+static int Resample(resampler_t *resampler, float fs, float tone, float *out)
+{
+    static float in[N_IN];
+    int n_out = 0;
+
+    for (int i = 0; i < N_IN; i++) {
+        in[i] = sinf(2 * M_PI * tone * i / fs);
+    }
+    ResamplerInit(resampler);
+    for (int i = 0; i < N_IN; i += BLOCK) {
+        n_out += ResamplerProcess(resampler, &in[i], &out[n_out], BLOCK);
+    }
+    return n_out;
+}
+
+/**
+ * 3/2 upsampling (1000 Hz -> 1500 Hz): 100 Hz passes, its 900 Hz image (600 Hz at the output) is removed
+ */
+static void TestUp(void)
+{
+    static float out[RESAMPLER_OUT_MAX(N_IN, 3, 2)];
+    resampler_t resampler = {.up = 3, .down = 2, .taps = 16, .passband = 0.9f};
+    int n = Resample(&resampler, 1000, 100, out);
+
+    CHECK(n == N_IN * 3 / 2, "resampler 3/2: %d samples (expected %d)", n, N_IN * 3 / 2);
+    float amp = Amplitude(&out[SETTLE], n - SETTLE, 100.0f / 1500);
+    float image = Amplitude(&out[SETTLE], n - SETTLE, 600.0f / 1500);
+    CHECK(fabsf(amp - 1) < 0.005f, "resampler 3/2: 100 Hz amplitude %f (expected 1)", amp);
+    CHECK(image < 0.01f, "resampler 3/2: 600 Hz image %f", image);
+    printf("resampler 3/2: %d samples, 100 Hz %.4f, 600 Hz image %.5f\n", n, amp, image);
+}
+
+/**
+ * 2/3 downsampling (1500 Hz -> 1000 Hz): 100 Hz passes, 700 Hz (aliased to 300 Hz) is removed
+ */
+static void TestDown(void)
+{
+    static float out[RESAMPLER_OUT_MAX(N_IN, 2, 3)];
+    resampler_t resampler = {.up = 2, .down = 3, .taps = 16, .passband = 0.9f};
+    int n = Resample(&resampler, 1500, 100, out);
+
+    CHECK(n == N_IN * 2 / 3, "resampler 2/3: %d samples (expected %d)", n, N_IN * 2 / 3);
+    float amp = Amplitude(&out[SETTLE], n - SETTLE, 100.0f / 1000);
+    CHECK(fabsf(amp - 1) < 0.005f, "resampler 2/3: 100 Hz amplitude %f (expected 1)", amp);
+
+    n = Resample(&resampler, 1500, 700, out);
+    float alias = Amplitude(&out[SETTLE], n - SETTLE, 300.0f / 1000);
+    CHECK(alias < 0.01f, "resampler 2/3: 700 Hz aliased to 300 Hz %f", alias);
+    printf("resampler 2/3: %d samples, 100 Hz %.4f, 700 Hz alias %.5f\n", n, amp, alias);
+}
+
+/**
+ * Same output whatever the input chunk size, including chunks shorter than the filter
+ */
+static void TestChunks(void)
+{
+    static float in[N_IN], whole[RESAMPLER_OUT_MAX(N_IN, 3, 2)], chunked[RESAMPLER_OUT_MAX(N_IN, 3, 2)];
+    resampler_t resampler = {.up = 3, .down = 2, .taps = 16, .passband = 0.9f};
+    int n_whole, n_chunked = 0;
+    float err = 0;
+
+    for (int i = 0; i < N_IN; i++) {
+        in[i] = rand() / (float)RAND_MAX - 0.5f;
+    }
+    ResamplerInit(&resampler);
+    n_whole = ResamplerProcess(&resampler, in, whole, N_IN);
+    ResamplerInit(&resampler);
+    for (int i = 0; i < N_IN; i += 7) {
+        int len = (i + 7 <= N_IN) ? 7 : N_IN - i;
+        n_chunked += ResamplerProcess(&resampler, &in[i], &chunked[n_chunked], len);
+    }
+    CHECK(n_chunked == n_whole, "resampler chunks: %d samples (expected %d)", n_chunked, n_whole);
+    for (int i = 0; i < n_whole && i < n_chunked; i++) {
+        err = fmaxf(err, fabsf(whole[i] - chunked[i]));
+    }
+    CHECK(err < 1e-6f, "resampler chunks: max difference %g", err);
+}
+
+void test_resampler(void)
+{
+    TestUp();
+    TestDown();
+    TestChunks();
+}
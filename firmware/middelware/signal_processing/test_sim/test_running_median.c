@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "running_median.h"
+#include "test_sim.h"
+
+#define SIGNAL_LEN  2000
+
+static int Compare(const void *a, const void *b)
+{
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Percentile (nearest rank) of the last samples, sorting them
+ */
+static float BruteForce(const float *signal, int n, int window, int percentile)
+{
+    float sorted[RUNNING_MEDIAN_MAX];
+    int count = (n + 1 < window) ? n + 1 : window;
+    for (int i = 0; i < count; i++) {
+        sorted[i] = signal[n - count + 1 + i];
+    }
+    qsort(sorted, count, sizeof(float), Compare);
+    return sorted[(percentile * (count - 1) + 50) / 100];
+}
+
+static void TestFilter(int window, int percentile, const float *signal)
+{
+    static float output[SIGNAL_LEN];
+    running_median_t filter = {.window = window, .percentile = percentile};
+    int wrong = 0;
+    RunningMedianInit(&filter);
+    /* Blocks of different lenghts */
+    for (int i = 0; i < SIGNAL_LEN; i += 7) {
+        RunningMedianProcess(&filter, &signal[i], &output[i], (i + 7 <= SIGNAL_LEN) ? 7 : SIGNAL_LEN - i);
+    }
+    for (int n = 0; n < SIGNAL_LEN; n++) {
+        wrong += (output[n] != BruteForce(signal, n, window, percentile));
+    }
+    CHECK(wrong == 0, "running median window %d percentile %d: %d wrong outputs", window, percentile, wrong);
+}
+
+void test_running_median(void)
+{
+    static float signal[SIGNAL_LEN], clean[SIGNAL_LEN];
+    static const int windows[] = {1, 2, 3, 5, 8, 31, 64};
+    static const int percentiles[] = {0, 10, 50, 90, 100};
+
+    /* Distance readings (cm) with spikes and repeated values, as HC-SR04 */
+    for (int n = 0; n < SIGNAL_LEN; n++) {
+        clean[n] = (int)(50 + 20 * sinf(2 * M_PI * n / 400));
+        signal[n] = clean[n] + (rand() % 3 - 1);
+        if (rand() % 20 == 0) {
+            signal[n] = (rand() % 2) ? 300 : 0;
+        }
+    }
+    for (int w = 0; w < sizeof(windows) / sizeof(windows[0]); w++) {
+        for (int p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); p++) {
+            TestFilter(windows[w], percentiles[p], signal);
+        }
+    }
+    /* Spikes removed by a 5 samples median */
+    running_median_t median = {.window = 5, .percentile = 50};
+    float max_error = 0;
+    RunningMedianInit(&median);
+    for (int n = 0; n < SIGNAL_LEN; n++) {
+        float out = RunningMedianUpdate(&median, signal[n]);
+        if (n >= 5) {
+            max_error = fmaxf(max_error, fabsf(out - clean[n - 2]));
+        }
+    }
+    printf("running median: 5 samples median of readings with spikes, max error %.1f cm\n", max_error);
+    CHECK(max_error <= 3, "running median: spikes not removed");
+}
@@ -0,0 +1,25 @@
+/**
+ * Shared by the test_sim tests: failure counter, CHECK() and the test entry points run by main.c.
+ */
+#ifndef TEST_SIM_H
+#define TEST_SIM_H
+
+#include <stdio.h>
+
+/* Failed checks of all the tests */
+extern int test_failures;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); test_failures++; } } while (0)
+
+void test_qrs_detector(void);
+void test_hrv(void);
+void test_goertzel(void);
+void test_welch(void);
+void test_nlms_filter(void);
+void test_running_median(void);
+void test_ecg_codec(void);
+void test_resampler(void);
+void test_adpcm(void);
+void test_band_analyzer(void);
+
+#endif /* TEST_SIM_H */
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "fft.h"
+#include "test_sim.h"
+
+#define FS          500
+#define SEGMENT     256
+#define SIGNAL_LEN  (60 * FS)
+#define TONE_FREQ   50.0f
+#define TONE_AMP    1.0f
+#define NOISE_AMP   1.0f    /* Uniform noise in [-NOISE_AMP, NOISE_AMP]: power NOISE_AMP^2 / 3 */
+
+/**
+ * Runs a Welch estimator over the signal in chunks of the given lenght
+ */
+static void RunWelch(welch_t *welch, const float *signal, int n, int chunk)
+{
+    WelchInit(welch);
+    for (int i = 0; i < n; i += chunk) {
+        int len = (i + chunk <= n) ? chunk : n - i;
+        WelchProcess(welch, &signal[i], len);
+    }
+}
+
+void test_welch(void)
+{
+    static float signal[SIGNAL_LEN];
+    static welch_t welch = {.sample_freq = FS, .segment_lenght = SEGMENT, .overlap = SEGMENT / 2};
+    static welch_t welch_block = {.sample_freq = FS, .segment_lenght = SEGMENT, .overlap = SEGMENT / 2};
+    float psd[SEGMENT / 2], psd_block[SEGMENT / 2];
+    float df = (float)FS / SEGMENT;
+
+    FFTInit();
+    for (int i = 0; i < SIGNAL_LEN; i++) {
+        signal[i] = TONE_AMP * sinf(2 * M_PI * TONE_FREQ * i / FS) + NOISE_AMP * (2.0f * rand() / (float)RAND_MAX - 1);
+    }
+    /* Samples arriving one by one and in a single block must give the same PSD */
+    RunWelch(&welch, signal, SIGNAL_LEN, 1);
+    RunWelch(&welch_block, signal, SIGNAL_LEN, SIGNAL_LEN > 65535 ? 65535 : SIGNAL_LEN);
+    int expected_segments = (SIGNAL_LEN - SEGMENT) / (SEGMENT / 2) + 1;
+    CHECK(welch.n_segments == expected_segments, "welch: %u segments (expected %d)", (unsigned)welch.n_segments, expected_segments);
+    CHECK(WelchPSD(&welch, psd) && WelchPSD(&welch_block, psd_block), "welch: no PSD");
+    float diff = 0;
+    for (int k = 0; k < SEGMENT / 2; k++) {
+        diff = fmaxf(diff, fabsf(psd[k] - psd_block[k]));
+    }
+    CHECK(diff < 1e-6f, "welch: sample by sample and block PSD differ (%g)", diff);
+
+    /* Tone: power around its bin, noise: mean PSD away from the tone */
+    int bin = TONE_FREQ / df + 0.5f;
+    float tone = 0, noise = 0;
+    int n_noise = 0;
+    for (int k = 1; k < SEGMENT / 2; k++) {
+        if (abs(k - bin) <= 3) {
+            tone += psd[k] * df;
+        } else {
+            noise += psd[k];
+            n_noise++;
+        }
+    }
+    noise /= n_noise;
+    float noise_expected = NOISE_AMP * NOISE_AMP / 3 / (FS / 2.0f);
+    tone -= 7 * noise * df;
+    printf("welch: %u segments, tone power %.3f (expected %.3f), noise PSD %.5f (expected %.5f)\n",
+           (unsigned)welch.n_segments, tone, TONE_AMP * TONE_AMP / 2, noise, noise_expected);
+    CHECK(fabsf(tone - TONE_AMP * TONE_AMP / 2) < 0.02f, "welch: tone power");
+    CHECK(fabsf(noise - noise_expected) < 0.05f * noise_expected, "welch: noise PSD");
+}